@@ -23,14 +23,64 @@ else:win32:CONFIG(debug, debug|release): \
     -lopencv_highgui244d  \
     -lopencv_imgproc244d
 
+unix: LIBS += -pthread
+
 
 SOURCES += \
     src/iou.cpp \
+    src/iou_box3d.cpp \
+    src/iou_clip.cpp \
+    src/iou_compact.cpp \
+    src/iou_decompose.cpp \
+    src/iou_engine.cpp \
+    src/iou_gjk.cpp \
+    src/iou_ingest.cpp \
+    src/iou_locate.cpp \
+    src/iou_parallel.cpp \
+    src/iou_rle.cpp \
+    src/iou_service.cpp \
+    src/iou_simd.cpp \
+    src/iou_simd_avx2.cpp \
+    src/iou_simd_avx512.cpp \
+    src/iou_sweep.cpp \
+    src/iou_tile.cpp \
+    src/iou_union.cpp \
+    test/check.cpp \
+    test/check_box3d.cpp \
+    test/check_compact.cpp \
+    test/check_decompose.cpp \
+    test/check_engine.cpp \
+    test/check_gjk.cpp \
+    test/check_ingest.cpp \
+    test/check_locate.cpp \
+    test/check_rle.cpp \
+    test/check_service.cpp \
+    test/check_simd.cpp \
+    test/check_sweep.cpp \
+    test/check_tile.cpp \
+    test/check_union.cpp \
     test/main.cpp \
     test/test.cpp \
 
 HEADERS += \
     src/iou.h \
+    src/iou_box3d.h \
+    src/iou_clip.h \
+    src/iou_compact.h \
+    src/iou_decompose.h \
+    src/iou_engine.h \
+    src/iou_gjk.h \
+    src/iou_ingest.h \
+    src/iou_locate.h \
+    src/iou_parallel.h \
+    src/iou_rle.h \
+    src/iou_service.h \
+    src/iou_simd.h \
+    src/iou_simd_kernel.h \
+    src/iou_sweep.h \
+    src/iou_tile.h \
+    src/iou_union.h \
+    test/check.h \
     test/test.h
 
 DISTFILES += \
@@ -0,0 +1,364 @@
+/***********************************
+ * iou_box3d.cpp
+ *
+ * Calculate the iou ratio of 3D boxes with yaw.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "iou_box3d.h"
+#include "iou_clip.h"
+#include "iou_parallel.h"
+#include <algorithm>
+
+namespace IOU
+{
+
+Quad Box3d::bev() const
+{
+    const double c = cos(yaw);
+    const double s = sin(yaw);
+    const Point u(c * l * 0.5, s * l * 0.5);   // Half heading.
+    const Point v(-s * w * 0.5, c * w * 0.5);  // Half side.
+    const Point o(x, y);
+    return Quad(o + u + v, o + u - v, o - u - v, o - u + v);
+}
+
+// BEV footprint in anticlockwise, as clipAreaConvex() takes it.
+struct Footprint {
+    Point p[4];
+};
+static Footprint footprintOf(const Box3d &B)
+{
+    const Quad Q = B.bev();
+    Footprint f;
+    f.p[0] = Q.p4;
+    f.p[1] = Q.p3;
+    f.p[2] = Q.p2;
+    f.p[3] = Q.p1;
+    return f;
+}
+static double footprintIntersection(const Footprint &F1, const Footprint &F2,
+                                    Vertexes &buf0, Vertexes &buf1)
+{
+    return clipAreaConvex(F1.p, 4, F2.p, 4, buf0, buf1);
+}
+
+// IoU of two valid boxes whose footprints are already built.
+// Pairs that can not overlap are rejected before clipping.
+static double iouBox3dPair(const Box3d &B1, const Footprint &F1,
+                           const Box3d &B2, const Footprint &F2,
+                           const Box3dMode mode, Vertexes &buf0, Vertexes &buf1)
+{
+    double dh = 1.0;
+    if (mode == VolumeMode) {
+        dh = std::min(B1.zMax(), B2.zMax()) - std::max(B1.zMin(), B2.zMin());
+        if (dh <= 0.0)
+            return 0.0;
+    }
+    const double dx = B1.x - B2.x;
+    const double dy = B1.y - B2.y;
+    const double r = B1.radius() + B2.radius();
+    if (dx*dx + dy*dy >= r*r)
+        return 0.0;
+
+    double inter = footprintIntersection(F1, F2, buf0, buf1);
+    if (mode == BevMode)
+        return inter / (B1.bevArea() + B2.bevArea() - inter);
+    inter *= dh;
+    return inter / (B1.volume() + B2.volume() - inter);
+}
+static bool isValidBox3d(const Box3d &B)
+{
+    return B.l > EPS && B.w > EPS;
+}
+
+double areaIntersectionBev(const Box3d &B1, const Box3d &B2)
+{
+    if (!isValidBox3d(B1) || !isValidBox3d(B2))
+        return -1.0;
+    Vertexes buf0, buf1;
+    return footprintIntersection(footprintOf(B1), footprintOf(B2), buf0, buf1);
+}
+double iouBev(const Box3d &B1, const Box3d &B2)
+{
+    if (!isValidBox3d(B1) || !isValidBox3d(B2))
+        return -1.0;
+    Vertexes buf0, buf1;
+    return iouBox3dPair(B1, footprintOf(B1), B2, footprintOf(B2), BevMode, buf0, buf1);
+}
+double volumeIntersection3d(const Box3d &B1, const Box3d &B2)
+{
+    if (!isValidBox3d(B1) || !isValidBox3d(B2))
+        return -1.0;
+    const double dh = std::min(B1.zMax(), B2.zMax()) - std::max(B1.zMin(), B2.zMin());
+    if (dh <= 0.0)
+        return 0.0;
+    Vertexes buf0, buf1;
+    return footprintIntersection(footprintOf(B1), footprintOf(B2), buf0, buf1) * dh;
+}
+double iou3d(const Box3d &B1, const Box3d &B2)
+{
+    if (!isValidBox3d(B1) || !isValidBox3d(B2))
+        return -1.0;
+    Vertexes buf0, buf1;
+    return iouBox3dPair(B1, footprintOf(B1), B2, footprintOf(B2), VolumeMode, buf0, buf1);
+}
+
+// Uniform grid over the BEV centers, in cells of a typical box size.
+// Boxes up to rBox of the grid and rQuery of the queries in radius overlap
+// only within neighbouring cells. A larger box of the grid is also listed
+// in every cell that may hold the center of a query box it overlaps, and
+// a larger query box looks through the cells it reaches and through the
+// larger boxes of the grid one by one.
+class CenterGrid {
+public:
+    void build(const std::vector<Box3d> &boxes, double rBox, double rQuery)
+    {
+        rGrid = rBox;
+        rNear = rQuery;
+        cell = rBox + rQuery > EPS ? rBox + rQuery : 1.0;
+        const int N = boxes.size();
+        std::vector<std::pair<long long, int> > entries;
+        entries.reserve(N);
+        bigs.clear();
+        for (int i = 0; i < N; ++i) {
+            const Box3d &B = boxes[i];
+            if (!(B.radius() > rBox)) {
+                entries.push_back(std::make_pair(keyOf(B.x, B.y), i));
+                continue;
+            }
+            bigs.push_back(i);
+            const double reach = B.radius() + rQuery;
+            const long long cx0 = cellOf(B.x - reach), cx1 = cellOf(B.x + reach);
+            const long long cy0 = cellOf(B.y - reach), cy1 = cellOf(B.y + reach);
+            for (long long cx = cx0; cx <= cx1; ++cx) {
+                for (long long cy = cy0; cy <= cy1; ++cy)
+                    entries.push_back(std::make_pair(keyOfCell(cx, cy), ~i));
+            }
+        }
+        std::sort(entries.begin(), entries.end());
+        keys.resize(entries.size());
+        ids.resize(entries.size());
+        for (int i = 0; i < (int)entries.size(); ++i) {
+            keys[i] = entries[i].first;
+            ids[i] = entries[i].second;
+        }
+    }
+    // Call f(id) once for every box that may overlap the one of radius r
+    // at (x, y).
+    template <typename Func>
+    void visit(double x, double y, double r, Func f) const
+    {
+        const bool bBig = r > rNear;
+        const double reach = r + rGrid;
+        const long long cx = cellOf(x), cy = cellOf(y);
+        const long long cx0 = bBig ? cellOf(x - reach) : cx - 1, cx1 = bBig ? cellOf(x + reach) : cx + 1;
+        const long long cy0 = bBig ? cellOf(y - reach) : cy - 1, cy1 = bBig ? cellOf(y + reach) : cy + 1;
+        for (long long i = cx0; i <= cx1; ++i) {
+            for (long long j = cy0; j <= cy1; ++j) {
+                const long long key = keyOfCell(i, j);
+                std::vector<long long>::const_iterator it =
+                        std::lower_bound(keys.begin(), keys.end(), key);
+                for (; it != keys.end() && *it == key; ++it) {
+                    const int id = ids[it - keys.begin()];
+                    if (id >= 0)
+                        f(id);
+                    else if (!bBig && i == cx && j == cy)
+                        f(~id);
+                }
+            }
+        }
+        if (bBig) {
+            for (int k = 0; k < (int)bigs.size(); ++k)
+                f(bigs[k]);
+        }
+    }
+
+private:
+    double rGrid;
+    double rNear;
+    double cell;
+    std::vector<long long> keys;
+    std::vector<int> ids;   // ~id for the copies of a larger box.
+    std::vector<int> bigs;  // Boxes larger than rGrid.
+
+    long long cellOf(double v) const { return (long long)floor(v / cell); }
+    long long keyOf(double x, double y) const { return keyOfCell(cellOf(x), cellOf(y)); }
+    static long long keyOfCell(long long cx, long long cy) {
+        return (long long)(((unsigned long long)cx << 32) | (unsigned int)cy); }
+};
+
+// The radius that all but 1% of the boxes are within, so that a few
+// large ones do not set the cell size of the grid.
+static double typicalRadius(const std::vector<Box3d> &boxes)
+{
+    std::vector<double> radii;
+    radii.reserve(boxes.size());
+    for (int i = 0; i < (int)boxes.size(); ++i) {
+        if (isValidBox3d(boxes[i]))
+            radii.push_back(boxes[i].radius());
+    }
+    if (radii.empty())
+        return 0.0;
+    const int k = (int)(radii.size() * 0.99);
+    std::nth_element(radii.begin(), radii.begin() + k, radii.end());
+    return radii[k];
+}
+static void footprintsOf(const std::vector<Box3d> &boxes, std::vector<Footprint> &feet)
+{
+    std::vector<Footprint> _feet(boxes.size());
+    parallelFor(boxes.size(), [&](int b, int e) {
+        for (int i = b; i < e; ++i)
+            _feet[i] = footprintOf(boxes[i]);
+    });
+    feet.swap(_feet);
+}
+static void orderByScore(const std::vector<double> &scores, std::vector<int> &order)
+{
+    std::vector<int> _order(scores.size());
+    for (int i = 0; i < (int)_order.size(); ++i)
+        _order[i] = i;
+    std::stable_sort(_order.begin(), _order.end(),
+                     [&](int a, int b) { return scores[a] > scores[b]; });
+    order.swap(_order);
+}
+
+void iouBox3dBatch(const std::vector<Box3d> &B1s, const std::vector<Box3d> &B2s,
+                   std::vector<double> &ious, const Box3dMode mode)
+{
+    const int N = B1s.size();
+    const int M = B2s.size();
+    std::vector<double> _ious((size_t)N * M, 0.0);
+
+    std::vector<Footprint> F1s, F2s;
+    footprintsOf(B1s, F1s);
+    footprintsOf(B2s, F2s);
+    parallelFor(N, [&](int b, int e) {
+        Vertexes buf0, buf1;
+        for (int i = b; i < e; ++i) {
+            double *row = &_ious[(size_t)i * M];
+            for (int j = 0; j < M; ++j) {
+                if (!isValidBox3d(B1s[i]) || !isValidBox3d(B2s[j]))
+                    row[j] = -1.0;
+                else
+                    row[j] = iouBox3dPair(B1s[i], F1s[i], B2s[j], F2s[j], mode, buf0, buf1);
+            }
+        }
+    });
+    ious.swap(_ious);
+}
+
+void nmsBox3d(const std::vector<Box3d> &boxes, const std::vector<double> &scores,
+              const double iouThresh, std::vector<int> &keep,
+              const Box3dMode mode)
+{
+    assert(boxes.size() == scores.size());
+    const int N = boxes.size();
+    std::vector<int> _keep;
+
+    std::vector<int> order;
+    orderByScore(scores, order);
+    std::vector<int> rank(N);
+    for (int i = 0; i < N; ++i)
+        rank[order[i]] = i;
+
+    std::vector<Footprint> feet;
+    footprintsOf(boxes, feet);
+    CenterGrid grid;
+    const double r = typicalRadius(boxes);
+    grid.build(boxes, r, r);
+
+    // For every box, find the higher-scored boxes that would suppress it.
+    // This is the expensive part and runs in parallel; the greedy pass
+    // below only reads the lists.
+    std::vector<std::vector<int> > suppressors(N);
+    parallelFor(N, [&](int b, int e) {
+        Vertexes buf0, buf1;
+        for (int i = b; i < e; ++i) {
+            if (!isValidBox3d(boxes[i]))
+                continue;
+            grid.visit(boxes[i].x, boxes[i].y, boxes[i].radius(), [&](int j) {
+                if (rank[j] < rank[i] && isValidBox3d(boxes[j]) &&
+                    iouBox3dPair(boxes[i], feet[i], boxes[j], feet[j], mode, buf0, buf1) > iouThresh)
+                    suppressors[i].push_back(j);
+            });
+        }
+    });
+
+    std::vector<char> kept(N, 0);
+    for (int k = 0; k < N; ++k) {
+        const int i = order[k];
+        bool bKeep = true;
+        for (int s = 0; s < (int)suppressors[i].size(); ++s) {
+            if (kept[suppressors[i][s]]) {
+                bKeep = false;
+                break;
+            }
+        }
+        if (bKeep) {
+            kept[i] = 1;
+            _keep.push_back(i);
+        }
+    }
+    keep.swap(_keep);
+}
+
+int matchBox3d(const std::vector<Box3d> &dets, const std::vector<double> &scores,
+               const std::vector<Box3d> &gts, const double iouThresh,
+               std::vector<int> &matches, const Box3dMode mode)
+{
+    assert(dets.size() == scores.size());
+    const int N = dets.size();
+    std::vector<int> _matches(N, -1);
+
+    std::vector<Footprint> detFeet, gtFeet;
+    footprintsOf(dets, detFeet);
+    footprintsOf(gts, gtFeet);
+    CenterGrid grid;
+    grid.build(gts, typicalRadius(gts), typicalRadius(dets));
+
+    // Candidate ground truths of every detection, by decreasing IoU.
+    typedef std::pair<double, int> Candidate;
+    std::vector<std::vector<Candidate> > candidates(N);
+    parallelFor(N, [&](int b, int e) {
+        Vertexes buf0, buf1;
+        for (int i = b; i < e; ++i) {
+            if (!isValidBox3d(dets[i]))
+                continue;
+            grid.visit(dets[i].x, dets[i].y, dets[i].radius(), [&](int j) {
+                if (!isValidBox3d(gts[j]))
+                    return;
+                const double v = iouBox3dPair(dets[i], detFeet[i], gts[j], gtFeet[j], mode, buf0, buf1);
+                if (v >= iouThresh && v > 0.0)
+                    candidates[i].push_back(Candidate(v, j));
+            });
+            std::sort(candidates[i].begin(), candidates[i].end(),
+                      [](const Candidate &a, const Candidate &b) {
+                return a.first > b.first || (a.first == b.first && a.second < b.second); });
+        }
+    });
+
+    std::vector<int> order;
+    orderByScore(scores, order);
+    std::vector<char> taken(gts.size(), 0);
+    int nMatched = 0;
+    for (int k = 0; k < N; ++k) {
+        const int i = order[k];
+        for (int c = 0; c < (int)candidates[i].size(); ++c) {
+            const int j = candidates[i][c].second;
+            if (!taken[j]) {
+                taken[j] = 1;
+                _matches[i] = j;
+                ++nMatched;
+                break;
+            }
+        }
+    }
+    matches.swap(_matches);
+    return nMatched;
+}
+
+}
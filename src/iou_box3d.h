@@ -0,0 +1,74 @@
+/***********************************
+ * iou_box3d.h
+ *
+ * Calculate the iou ratio of 3D boxes with yaw,
+ * i.e. the bird's-eye-view (BEV) quad intersection
+ * times the vertical overlap.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#ifndef _IOU_BOX3D_H_FILE_
+#define _IOU_BOX3D_H_FILE_
+
+#include "iou.h"
+
+namespace IOU
+{
+    enum Box3dMode
+    {
+        BevMode,    // IoU of the BEV footprints.
+        VolumeMode  // IoU of the volumes.
+    };
+
+    class Box3d {
+    public:
+        // Members
+        double x, y, z;  // Center.
+        double l, w, h;  // Size along the heading, across the heading and vertical.
+        double yaw;      // Heading in radians, counter-clockwise from +x.
+
+        // Constructors
+        Box3d() : x(0), y(0), z(0), l(0), w(0), h(0), yaw(0) {}
+        Box3d(double _x, double _y, double _z,
+              double _l, double _w, double _h, double _yaw)
+            : x(_x), y(_y), z(_z), l(_l), w(_w), h(_h), yaw(_yaw) {}
+
+        // Methods
+        Quad bev() const;  // BEV footprint, in clockwise.
+        double bevArea() const { return l * w; }
+        double volume() const { return l * w * h; }
+        double zMin() const { return z - h * 0.5; }
+        double zMax() const { return z + h * 0.5; }
+        double radius() const { return 0.5 * sqrt(l*l + w*w); }
+    };
+
+    // Return -1.0 for boxes with an empty footprint.
+    double areaIntersectionBev(const Box3d &B1, const Box3d &B2);
+    double iouBev(const Box3d &B1, const Box3d &B2);
+    double volumeIntersection3d(const Box3d &B1, const Box3d &B2);
+    double iou3d(const Box3d &B1, const Box3d &B2);
+
+    // All pairs, in parallel.
+    // ious is resized to B1s.size() x B2s.size(), in row-major order.
+    void iouBox3dBatch(const std::vector<Box3d> &B1s, const std::vector<Box3d> &B2s,
+                       std::vector<double> &ious, const Box3dMode mode = VolumeMode);
+
+    // Greedy non-maximum suppression.
+    // keep receives the indexes of the kept boxes, by decreasing score.
+    void nmsBox3d(const std::vector<Box3d> &boxes, const std::vector<double> &scores,
+                  const double iouThresh, std::vector<int> &keep,
+                  const Box3dMode mode = VolumeMode);
+
+    // Greedy matching of detections to ground truths.
+    // Detections are visited by decreasing score and take the unmatched
+    // ground truth of highest IoU not below iouThresh.
+    // matches[i] is the ground truth matched to dets[i], or -1.
+    // Return the number of matched detections.
+    int matchBox3d(const std::vector<Box3d> &dets, const std::vector<double> &scores,
+                   const std::vector<Box3d> &gts, const double iouThresh,
+                   std::vector<int> &matches, const Box3dMode mode = VolumeMode);
+}
+#endif // !_IOU_BOX3D_H_FILE_
@@ -0,0 +1,81 @@
+/***********************************
+ * iou_clip.cpp
+ *
+ * Intersection of convex polygons by clipping.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "iou_clip.h"
+#include <algorithm>
+
+namespace IOU
+{
+
+double clipAreaConvex(const Point *a, const int nA, const Point *b, const int nB,
+                      Vertexes &buf0, Vertexes &buf1)
+{
+    buf0.assign(a, a + nA);
+    for (int k = 0; k < nB && buf0.size() > 2; ++k) {
+        const Point &q = b[k];
+        const Point e = b[k + 1 < nB ? k + 1 : 0] - q;
+        const int N = buf0.size();
+        buf1.clear();
+        for (int i = 0; i < N; ++i) {
+            const Point &p0 = buf0[i];
+            const Point &p1 = buf0[i + 1 < N ? i + 1 : 0];
+            const double d0 = e ^ (p0 - q);
+            const double d1 = e ^ (p1 - q);
+            if (d0 >= 0.0)
+                buf1.push_back(p0);
+            if ((d0 >= 0.0) != (d1 >= 0.0))
+                buf1.push_back(p0 + (p1 - p0) * (d0 / (d0 - d1)));
+        }
+        buf0.swap(buf1);
+    }
+
+    const int N = buf0.size();
+    if (N < 3)
+        return 0.0;
+    double sArea = 0.0;
+    for (int i = 1; i < N - 1; ++i)
+        sArea += (buf0[i] - buf0[0]) ^ (buf0[i + 1] - buf0[0]);
+    return std::max(0.0, sArea * 0.5);
+}
+
+bool antiClockWise(const Vertexes &C, Vertexes &buf, const Vertexes **pC)
+{
+    const WiseType wise = whichWiseEx(C);
+    if (wise == NoneWise)
+        return false;
+    if (wise == ClockWise) {
+        buf.assign(C.rbegin(), C.rend());
+        *pC = &buf;
+    }
+    else {
+        *pC = &C;
+    }
+    return true;
+}
+
+double areaIntersectionClip(const Vertexes &C1, const Vertexes &C2)
+{
+    Vertexes r1, r2, buf0, buf1;
+    const Vertexes *p1 = 0;
+    const Vertexes *p2 = 0;
+    if (!antiClockWise(C1, r1, &p1) || !antiClockWise(C2, r2, &p2))
+        return -1.0;
+    return clipAreaConvex(*p1, *p2, buf0, buf1);
+}
+double iouClip(const Vertexes &C1, const Vertexes &C2)
+{
+    const double inter = areaIntersectionClip(C1, C2);
+    if (inter < 0.0)
+        return -1.0;
+    const double uni = areaEx(C1) + areaEx(C2) - inter;
+    return uni > 0.0 ? inter / uni : 0.0;
+}
+
+}
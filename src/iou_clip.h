@@ -0,0 +1,41 @@
+/***********************************
+ * iou_clip.h
+ *
+ * Intersection of convex polygons by clipping one by the half-planes
+ * of the other's edges (Sutherland-Hodgman).
+ *
+ * Unlike areaIntersectionEx(), which collects the crossing and inner
+ * points and sorts them, clipping has no line-line special case and
+ * gives an area for every pair of valid polygons, touching, nested or
+ * with parallel edges included.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#ifndef _IOU_CLIP_H_FILE_
+#define _IOU_CLIP_H_FILE_
+
+#include "iou.h"
+
+namespace IOU
+{
+    // Area of the intersection of two convex polygons in anticlockwise,
+    // nA vertexes at a and nB at b. Nothing is checked.
+    // buf0 and buf1 are scratch, kept by the caller between calls.
+    double clipAreaConvex(const Point *a, const int nA, const Point *b, const int nB,
+                          Vertexes &buf0, Vertexes &buf1);
+    inline double clipAreaConvex(const Vertexes &a, const Vertexes &b,
+                                 Vertexes &buf0, Vertexes &buf1) {
+        return clipAreaConvex(a.data(), a.size(), b.data(), b.size(), buf0, buf1); }
+
+    // C in anticlockwise: *pC is C itself, or buf holding C reversed.
+    // Return false for a non-convex polygon.
+    bool antiClockWise(const Vertexes &C, Vertexes &buf, const Vertexes **pC);
+
+    // Any convex polygons, in either wise. -1.0 for non-convex polygons.
+    double areaIntersectionClip(const Vertexes &C1, const Vertexes &C2);
+    double iouClip(const Vertexes &C1, const Vertexes &C2);
+}
+#endif // !_IOU_CLIP_H_FILE_
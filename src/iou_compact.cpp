@@ -0,0 +1,229 @@
+/***********************************
+ * iou_compact.cpp
+ *
+ * Convex polygons packed in a few flat buffers, with quantized vertexes,
+ * and iou calculated from the packed form.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "iou_compact.h"
+#include "iou_parallel.h"
+
+namespace IOU
+{
+
+// Largest delta, the bounding box spans [-QUANT_MAX, QUANT_MAX] steps.
+static const int QUANT_MAX = 32767;
+
+void CompactPolygonSet::clear()
+{
+    frames.clear();
+    offsets.assign(1, 0);
+    steps.clear();
+}
+void CompactPolygonSet::reserve(int nPolygons, size_t nVertexes)
+{
+    frames.reserve(nPolygons);
+    offsets.reserve(nPolygons + 1);
+    steps.reserve(2 * nVertexes);
+}
+
+static int16_t quantize(const double v, const float anchor, const float step)
+{
+    const double q = floor((v - anchor) / step + 0.5);
+    return (int16_t)std::max(-(double)QUANT_MAX, std::min((double)QUANT_MAX, q));
+}
+
+bool CompactPolygonSet::push_back(const Vertexes &C)
+{
+    const WiseType wise = whichWiseEx(C);
+    // Offsets are 32 bits, so a polygon past 2^32 vertexes in all is
+    // stored as a non-convex one.
+    const bool bFits = steps.size() / 2 + C.size() <= UINT32_MAX;
+    const int N = wise == NoneWise || !bFits ? 0 : C.size();
+
+    Frame f = {0.0f, 0.0f, 1.0f, 1.0f};
+    if (N > 0) {
+        double x0 = C[0].x, x1 = C[0].x, y0 = C[0].y, y1 = C[0].y;
+        for (int k = 1; k < N; ++k) {
+            x0 = std::min(x0, C[k].x);
+            x1 = std::max(x1, C[k].x);
+            y0 = std::min(y0, C[k].y);
+            y1 = std::max(y1, C[k].y);
+        }
+        // Steps are taken from the rounded anchor, so only the deltas round.
+        f.x = (float)((x0 + x1) * 0.5);
+        f.y = (float)((y0 + y1) * 0.5);
+        const double hx = std::max(x1 - f.x, f.x - x0);
+        const double hy = std::max(y1 - f.y, f.y - y0);
+        if (hx > 0.0)
+            f.sx = (float)(hx / QUANT_MAX);
+        if (hy > 0.0)
+            f.sy = (float)(hy / QUANT_MAX);
+    }
+    for (int k = 0; k < N; ++k) {
+        const Point &p = C[wise == ClockWise ? N - 1 - k : k];
+        steps.push_back(quantize(p.x, f.x, f.sx));
+        steps.push_back(quantize(p.y, f.y, f.sy));
+    }
+    frames.push_back(f);
+    offsets.push_back(offsets.back() + N);
+    return N > 0;
+}
+
+void CompactPolygonSet::decode(int i, Vertexes &C) const
+{
+    const Frame &f = frames[i];
+    const int16_t *d = deltas(i);
+    const int N = vertexCount(i);
+    C.resize(N);
+    for (int k = 0; k < N; ++k)
+        C[k] = Point(f.x + (double)f.sx * d[2 * k], f.y + (double)f.sy * d[2 * k + 1]);
+}
+
+size_t CompactPolygonSet::memoryBytes() const
+{
+    return frames.capacity() * sizeof(Frame) +
+           offsets.capacity() * sizeof(uint32_t) +
+           steps.capacity() * sizeof(int16_t);
+}
+
+//---------------
+// Area in squared steps, exact in integers.
+static double stepArea(const int16_t *d, const int N)
+{
+    long long s2 = 0;
+    for (int k = 0; k < N; ++k) {
+        const int k1 = k + 1 < N ? k + 1 : 0;
+        s2 += (long long)d[2 * k] * d[2 * k1 + 1] - (long long)d[2 * k1] * d[2 * k + 1];
+    }
+    return 0.5 * (double)s2;
+}
+
+static bool framesOverlap(const CompactPolygonSet::Frame &a, const CompactPolygonSet::Frame &b)
+{
+    return abs((double)a.x - b.x) < QUANT_MAX * ((double)a.sx + b.sx) &&
+           abs((double)a.y - b.y) < QUANT_MAX * ((double)a.sy + b.sy);
+}
+
+// As clipAreaConvex() of iou_clip.h: polygon i of A, decoded next to its
+// anchor, is clipped by each edge of polygon j of B, decoded as it is read.
+static double clipCompact(const CompactPolygonSet &A, const int i,
+                          const CompactPolygonSet &B, const int j,
+                          Vertexes &buf0, Vertexes &buf1)
+{
+    const CompactPolygonSet::Frame &fa = A.frame(i);
+    const CompactPolygonSet::Frame &fb = B.frame(j);
+    const int16_t *da = A.deltas(i);
+    const int16_t *db = B.deltas(j);
+    const int nA = A.vertexCount(i);
+    const int M = B.vertexCount(j);
+
+    buf0.resize(nA);
+    for (int k = 0; k < nA; ++k)
+        buf0[k] = Point((double)fa.sx * da[2 * k], (double)fa.sy * da[2 * k + 1]);
+
+    // B's anchor relative to A's.
+    const double ox = (double)fb.x - fa.x;
+    const double oy = (double)fb.y - fa.y;
+    Point q(ox + (double)fb.sx * db[0], oy + (double)fb.sy * db[1]);
+    for (int k = 0; k < M && buf0.size() > 2; ++k) {
+        const int k1 = k + 1 < M ? k + 1 : 0;
+        const Point q1(ox + (double)fb.sx * db[2 * k1], oy + (double)fb.sy * db[2 * k1 + 1]);
+        const Point e = q1 - q;
+        const int N = buf0.size();
+        buf1.clear();
+        for (int l = 0; l < N; ++l) {
+            const Point &p0 = buf0[l];
+            const Point &p1 = buf0[l + 1 < N ? l + 1 : 0];
+            const double d0 = e ^ (p0 - q);
+            const double d1 = e ^ (p1 - q);
+            if (d0 >= 0.0)
+                buf1.push_back(p0);
+            if ((d0 >= 0.0) != (d1 >= 0.0))
+                buf1.push_back(p0 + (p1 - p0) * (d0 / (d0 - d1)));
+        }
+        buf0.swap(buf1);
+        q = q1;
+    }
+
+    const int N = buf0.size();
+    if (N < 3)
+        return 0.0;
+    double sArea = 0.0;
+    for (int k = 1; k < N - 1; ++k)
+        sArea += (buf0[k] - buf0[0]) ^ (buf0[k + 1] - buf0[0]);
+    return std::max(0.0, sArea * 0.5);
+}
+
+static double interCompact(const CompactPolygonSet &S1, const int i,
+                           const CompactPolygonSet &S2, const int j,
+                           Vertexes &buf0, Vertexes &buf1)
+{
+    if (S1.vertexCount(i) == 0 || S2.vertexCount(j) == 0)
+        return -1.0;
+    if (!framesOverlap(S1.frame(i), S2.frame(j)))
+        return 0.0;
+    return clipCompact(S1, i, S2, j, buf0, buf1);
+}
+
+static double iouCompact(const CompactPolygonSet &S1, const int i,
+                         const CompactPolygonSet &S2, const int j,
+                         Vertexes &buf0, Vertexes &buf1)
+{
+    const double inter = interCompact(S1, i, S2, j, buf0, buf1);
+    if (inter < 0.0)
+        return -1.0;
+    const CompactPolygonSet::Frame &f1 = S1.frame(i);
+    const CompactPolygonSet::Frame &f2 = S2.frame(j);
+    const double uni = stepArea(S1.deltas(i), S1.vertexCount(i)) * f1.sx * f1.sy +
+                       stepArea(S2.deltas(j), S2.vertexCount(j)) * f2.sx * f2.sy - inter;
+    return uni > 0.0 ? inter / uni : 0.0;
+}
+
+double areaIntersectionCompact(const CompactPolygonSet &S1, const int i,
+                               const CompactPolygonSet &S2, const int j)
+{
+    Vertexes buf0, buf1;
+    return interCompact(S1, i, S2, j, buf0, buf1);
+}
+double iouCompact(const CompactPolygonSet &S1, const int i,
+                  const CompactPolygonSet &S2, const int j)
+{
+    Vertexes buf0, buf1;
+    return iouCompact(S1, i, S2, j, buf0, buf1);
+}
+
+void iouCompactBatch(const CompactPolygonSet &S1, const CompactPolygonSet &S2,
+                     std::vector<double> &ious)
+{
+    const int N = S1.size();
+    const int M = S2.size();
+    std::vector<double> _ious((size_t)N * M);
+    parallelFor(N, [&](int b, int e) {
+        Vertexes buf0, buf1;
+        for (int i = b; i < e; ++i) {
+            double *iouRow = &_ious[(size_t)i * M];
+            for (int j = 0; j < M; ++j)
+                iouRow[j] = iouCompact(S1, i, S2, j, buf0, buf1);
+        }
+    });
+    ious.swap(_ious);
+}
+void iouCompactPairs(const CompactPolygonSet &S1, const CompactPolygonSet &S2,
+                     const std::vector<std::pair<int, int> > &pairs, std::vector<double> &ious)
+{
+    const int P = pairs.size();
+    std::vector<double> _ious(P);
+    parallelFor(P, [&](int b, int e) {
+        Vertexes buf0, buf1;
+        for (int k = b; k < e; ++k)
+            _ious[k] = iouCompact(S1, pairs[k].first, S2, pairs[k].second, buf0, buf1);
+    });
+    ious.swap(_ious);
+}
+
+}
@@ -0,0 +1,81 @@
+/***********************************
+ * iou_compact.h
+ *
+ * Convex polygons packed in a few flat buffers, with quantized vertexes,
+ * and iou calculated from the packed form.
+ *
+ * Each polygon keeps a frame (anchor at its bounding box center and one
+ * step per axis, in single precision) and its vertexes as int16 steps from
+ * the anchor. Frames, offsets and steps each have their own flat buffer,
+ * so the set is three allocations however many polygons it holds. A quad
+ * takes 36 bytes, about a third of the 104 bytes of a std::vector of 4
+ * points with its heap block.
+ * The intersection is clipped as in iou_clip.h, decoding the vertexes as
+ * they are read, and the bounding boxes and areas come from the frames
+ * and steps without decoding.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#ifndef _IOU_COMPACT_H_FILE_
+#define _IOU_COMPACT_H_FILE_
+
+#include "iou.h"
+#include <algorithm>
+#include <stdint.h>
+
+namespace IOU
+{
+    class CompactPolygonSet {
+    public:
+        struct Frame {
+            float x, y;    // Anchor.
+            float sx, sy;  // Step of one unit of a delta.
+        };
+
+        // Constructors
+        CompactPolygonSet() : offsets(1, 0) {}
+
+        // Methods
+        int size() const { return frames.size(); }
+        void clear();
+        void reserve(int nPolygons, size_t nVertexes);
+        // Stored in anticlockwise. Non-convex polygons, and polygons that
+        // would take the set past 2^32 vertexes, are stored with no
+        // vertexes and give -1.0, and push_back() returns false.
+        bool push_back(const Vertexes &C);
+        // Decoded vertexes, within maxError() of the ones given.
+        void decode(int i, Vertexes &C) const;
+        double maxError(int i) const { return 0.5 * std::max(frames[i].sx, frames[i].sy); }
+        // Bytes held by the buffers.
+        size_t memoryBytes() const;
+
+        int vertexCount(int i) const { return offsets[i + 1] - offsets[i]; }
+        const Frame &frame(int i) const { return frames[i]; }
+        // x and y of each vertex, interleaved.
+        const int16_t *deltas(int i) const { return steps.data() + 2 * (size_t)offsets[i]; }
+
+    private:
+        std::vector<Frame> frames;
+        std::vector<uint32_t> offsets;  // First vertex of each polygon, and the end.
+        std::vector<int16_t> steps;
+    };
+
+    // Polygon i of S1 and polygon j of S2. -1.0 for non-convex polygons.
+    double areaIntersectionCompact(const CompactPolygonSet &S1, const int i,
+                                   const CompactPolygonSet &S2, const int j);
+    double iouCompact(const CompactPolygonSet &S1, const int i,
+                      const CompactPolygonSet &S2, const int j);
+
+    // Iou of all pairs, in parallel.
+    // ious is resized to S1.size() x S2.size(), in row-major order.
+    void iouCompactBatch(const CompactPolygonSet &S1, const CompactPolygonSet &S2,
+                         std::vector<double> &ious);
+    // Iou of the pairs (pairs[k].first of S1, pairs[k].second of S2), in parallel.
+    // ious is resized to pairs.size().
+    void iouCompactPairs(const CompactPolygonSet &S1, const CompactPolygonSet &S2,
+                         const std::vector<std::pair<int, int> > &pairs, std::vector<double> &ious);
+}
+#endif // !_IOU_COMPACT_H_FILE_
@@ -0,0 +1,365 @@
+/***********************************
+ * iou_decompose.cpp
+ *
+ * Intersection and iou of simple polygons, convex or not.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "iou_decompose.h"
+#include "iou_clip.h"
+#include "iou_parallel.h"
+#include <unordered_map>
+
+namespace IOU
+{
+
+static double orient(const Point &a, const Point &b, const Point &c)
+{
+    return (b - a) ^ (c - a);
+}
+
+// Drop repeated vertexes and those on the line through their neighbours.
+static void cleanVertexes(const Vertexes &C, Vertexes &V)
+{
+    V.clear();
+    for (int i = 0; i < (int)C.size(); ++i) {
+        if (V.empty() || !(C[i] == V.back()))
+            V.push_back(C[i]);
+    }
+    while (V.size() > 1 && V.front() == V.back())
+        V.pop_back();
+
+    bool bChanged = true;
+    while (bChanged && V.size() >= 3) {
+        bChanged = false;
+        for (int i = 0; i < (int)V.size() && V.size() >= 3; ) {
+            const int N = V.size();
+            const Point e0 = V[i] - V[(i + N - 1) % N];
+            const Point e1 = V[(i + 1) % N] - V[i];
+            if (abs(e0^e1) <= EPS * e0.norm() * e1.norm()) {
+                V.erase(V.begin() + i);
+                bChanged = true;
+            }
+            else {
+                ++i;
+            }
+        }
+    }
+}
+
+static bool inBox(const Point &a, const Point &b, const Point &p)
+{
+    return std::min(a.x, b.x) <= p.x && p.x <= std::max(a.x, b.x) &&
+           std::min(a.y, b.y) <= p.y && p.y <= std::max(a.y, b.y);
+}
+
+// Segments p1p2 and q1q2 cross or touch.
+static bool segmentsTouch(const Point &p1, const Point &p2, const Point &q1, const Point &q2)
+{
+    const double d1 = orient(q1, q2, p1);
+    const double d2 = orient(q1, q2, p2);
+    const double d3 = orient(p1, p2, q1);
+    const double d4 = orient(p1, p2, q2);
+    if (((d1 > 0.0 && d2 < 0.0) || (d1 < 0.0 && d2 > 0.0)) &&
+        ((d3 > 0.0 && d4 < 0.0) || (d3 < 0.0 && d4 > 0.0)))
+        return true;
+    return (d1 == 0.0 && inBox(q1, q2, p1)) || (d2 == 0.0 && inBox(q1, q2, p2)) ||
+           (d3 == 0.0 && inBox(p1, p2, q1)) || (d4 == 0.0 && inBox(p1, p2, q2));
+}
+
+// No two edges meet, except neighbours at their common vertex.
+static bool isSimple(const Vertexes &V)
+{
+    const int N = V.size();
+    for (int i = 0; i < N; ++i) {
+        const Point &p1 = V[i];
+        const Point &p2 = V[(i + 1) % N];
+        for (int j = i + 2; j < N; ++j) {
+            if (i == 0 && j == N - 1)
+                continue;
+            const Point &q1 = V[j];
+            const Point &q2 = V[(j + 1) % N];
+            if (std::max(p1.x, p2.x) < std::min(q1.x, q2.x) ||
+                std::max(q1.x, q2.x) < std::min(p1.x, p2.x))
+                continue;
+            if (segmentsTouch(p1, p2, q1, q2))
+                return false;
+        }
+    }
+    return true;
+}
+
+// Vertex i of the remaining polygon is an ear: convex, and no reflex
+// vertex in or on the triangle it cuts off.
+static bool isEar(const Vertexes &V, const std::vector<int> &prev, const std::vector<int> &next, const int i)
+{
+    const int a = prev[i];
+    const int c = next[i];
+    const Point &A = V[a];
+    const Point &B = V[i];
+    const Point &C = V[c];
+    if (orient(A, B, C) <= 0.0)
+        return false;
+    for (int j = next[c]; j != a; j = next[j]) {
+        const Point &p = V[j];
+        if (orient(V[prev[j]], p, V[next[j]]) > 0.0)
+            continue;
+        if (orient(A, B, p) >= 0.0 && orient(B, C, p) >= 0.0 && orient(C, A, p) >= 0.0)
+            return false;
+    }
+    return true;
+}
+
+// Triangles of a simple anticlockwise polygon, as index triples.
+static bool earClip(const Vertexes &V, std::vector<int> &tris)
+{
+    const int N = V.size();
+    std::vector<int> prev(N), next(N);
+    for (int i = 0; i < N; ++i) {
+        prev[i] = (i + N - 1) % N;
+        next[i] = (i + 1) % N;
+    }
+
+    int count = N;
+    int i = 0;
+    int nTried = 0;
+    while (count > 3) {
+        const bool bEar = isEar(V, prev, next, i);
+        // Clipping can leave a vertex on the line of its neighbours,
+        // drop it, it cuts off nothing.
+        const bool bFlat = !bEar && nTried > count && orient(V[prev[i]], V[i], V[next[i]]) == 0.0;
+        if (bEar || bFlat) {
+            if (bEar) {
+                tris.push_back(prev[i]);
+                tris.push_back(i);
+                tris.push_back(next[i]);
+            }
+            next[prev[i]] = next[i];
+            prev[next[i]] = prev[i];
+            i = prev[i];
+            --count;
+            nTried = 0;
+        }
+        else {
+            i = next[i];
+            if (++nTried > 2 * count)
+                return false;
+        }
+    }
+    tris.push_back(prev[i]);
+    tris.push_back(i);
+    tris.push_back(next[i]);
+    return true;
+}
+
+// Join loop P, which has the edge a->b, and loop Q, which has b->a,
+// if the result stays convex at a and b.
+static bool mergeLoops(const Vertexes &V, const std::vector<int> &P, const std::vector<int> &Q,
+                       const int a, const int b, std::vector<int> &merged)
+{
+    const int nP = P.size();
+    const int nQ = Q.size();
+    const int ib = std::find(P.begin(), P.end(), b) - P.begin();
+    const int ia = std::find(Q.begin(), Q.end(), a) - Q.begin();
+    merged.clear();
+    for (int k = 0; k < nP; ++k)        // b ... a
+        merged.push_back(P[(ib + k) % nP]);
+    for (int k = 1; k < nQ - 1; ++k)    // After a, before b.
+        merged.push_back(Q[(ia + k) % nQ]);
+
+    const int N = merged.size();
+    const int ka = nP - 1;
+    return orient(V[merged[ka - 1]], V[a], V[merged[ka + 1]]) >= 0.0 &&
+           orient(V[merged[N - 1]], V[b], V[merged[1]]) >= 0.0;
+}
+
+static int findRoot(std::vector<int> &parent, int t)
+{
+    while (parent[t] != t)
+        t = parent[t] = parent[parent[t]];
+    return t;
+}
+
+// Hertel-Mehlhorn: drop each diagonal whose two sides merge into a convex
+// polygon. At most four times the fewest possible convex pieces.
+static void mergeTriangles(const Vertexes &V, const std::vector<int> &tris,
+                           std::vector<std::vector<int> > &loops)
+{
+    const int T = tris.size() / 3;
+    const long long N = V.size();
+    loops.assign(T, std::vector<int>());
+    std::vector<int> parent(T);
+    for (int t = 0; t < T; ++t) {
+        loops[t].assign(tris.begin() + 3 * t, tris.begin() + 3 * t + 3);
+        parent[t] = t;
+    }
+
+    // A diagonal is an edge a->b of one triangle found as b->a in another.
+    std::unordered_map<long long, int> edgeOf;
+    std::vector<int> diags;  // a, b, triangle with a->b, triangle with b->a.
+    for (int t = 0; t < T; ++t) {
+        for (int e = 0; e < 3; ++e) {
+            const int a = tris[3 * t + e];
+            const int b = tris[3 * t + (e + 1) % 3];
+            std::unordered_map<long long, int>::iterator it = edgeOf.find(b * N + a);
+            if (it == edgeOf.end()) {
+                edgeOf[a * N + b] = t;
+                continue;
+            }
+            diags.push_back(a);
+            diags.push_back(b);
+            diags.push_back(t);
+            diags.push_back(it->second);
+        }
+    }
+
+    std::vector<int> merged;
+    for (int d = 0; d < (int)diags.size(); d += 4) {
+        const int p = findRoot(parent, diags[d + 2]);
+        const int q = findRoot(parent, diags[d + 3]);
+        if (p == q)
+            continue;
+        if (mergeLoops(V, loops[p], loops[q], diags[d], diags[d + 1], merged)) {
+            loops[p].swap(merged);
+            loops[q].clear();
+            parent[q] = p;
+        }
+    }
+}
+
+//---------------
+DecomposedPolygon::DecomposedPolygon(const Vertexes &C)
+    : bValid(false), sArea(0.0)
+{
+    box.x0 = box.x1 = box.y0 = box.y1 = 0.0;
+    Vertexes V;
+    cleanVertexes(C, V);
+    const int N = V.size();
+    if (N < 3)
+        return;
+    double s2 = 0.0;
+    for (int i = 0; i < N; ++i)
+        s2 += V[i] ^ V[(i + 1) % N];
+    if (s2 == 0.0 || !isSimple(V))
+        return;
+    if (s2 < 0.0)
+        std::reverse(V.begin(), V.end());
+
+    if (whichWiseEx(V) != NoneWise) {
+        pieces.push_back(V);
+    }
+    else {
+        std::vector<int> tris;
+        if (!earClip(V, tris))
+            return;
+        std::vector<std::vector<int> > loops;
+        mergeTriangles(V, tris, loops);
+        for (int t = 0; t < (int)loops.size(); ++t) {
+            if (loops[t].empty())
+                continue;
+            Vertexes piece;
+            for (int k = 0; k < (int)loops[t].size(); ++k)
+                piece.push_back(V[loops[t][k]]);
+            pieces.push_back(piece);
+        }
+    }
+
+    for (int i = 0; i < (int)pieces.size(); ++i) {
+        const Vertexes &piece = pieces[i];
+        Box b = {piece[0].x, piece[0].x, piece[0].y, piece[0].y};
+        for (int k = 1; k < (int)piece.size(); ++k) {
+            b.x0 = std::min(b.x0, piece[k].x);
+            b.x1 = std::max(b.x1, piece[k].x);
+            b.y0 = std::min(b.y0, piece[k].y);
+            b.y1 = std::max(b.y1, piece[k].y);
+        }
+        boxes.push_back(b);
+        if (i == 0) {
+            box = b;
+        }
+        else {
+            box.x0 = std::min(box.x0, b.x0);
+            box.x1 = std::max(box.x1, b.x1);
+            box.y0 = std::min(box.y0, b.y0);
+            box.y1 = std::max(box.y1, b.y1);
+        }
+    }
+    sArea = abs(s2) * 0.5;
+    bValid = true;
+}
+
+double DecomposedPolygon::areaIntersection(const DecomposedPolygon &other) const
+{
+    if (!bValid || !other.bValid)
+        return -1.0;
+    if (!box.overlaps(other.box))
+        return 0.0;
+
+    // The pieces do not overlap, so their intersections add up. They are
+    // convex and in anticlockwise already, so they go to the clipper as is.
+    double sInter = 0.0;
+    Vertexes buf0, buf1;
+    for (int i = 0; i < (int)pieces.size(); ++i) {
+        if (!boxes[i].overlaps(other.box))
+            continue;
+        for (int j = 0; j < (int)other.pieces.size(); ++j) {
+            if (!boxes[i].overlaps(other.boxes[j]))
+                continue;
+            sInter += clipAreaConvex(pieces[i], other.pieces[j], buf0, buf1);
+        }
+    }
+    return std::min(sInter, std::min(sArea, other.sArea));
+}
+
+//---------------
+double areaIntersectionSimple(const DecomposedPolygon &P1, const DecomposedPolygon &P2)
+{
+    return P1.areaIntersection(P2);
+}
+double areaUnionSimple(const DecomposedPolygon &P1, const DecomposedPolygon &P2)
+{
+    const double inter = P1.areaIntersection(P2);
+    if (inter < 0.0)
+        return -1.0;
+    return P1.area() + P2.area() - inter;
+}
+double iouSimple(const DecomposedPolygon &P1, const DecomposedPolygon &P2)
+{
+    const double inter = P1.areaIntersection(P2);
+    if (inter < 0.0)
+        return -1.0;
+    const double uni = P1.area() + P2.area() - inter;
+    return uni > 0.0 ? inter / uni : 0.0;
+}
+double areaIntersectionSimple(const Vertexes &C1, const Vertexes &C2)
+{
+    return areaIntersectionSimple(DecomposedPolygon(C1), DecomposedPolygon(C2));
+}
+double areaUnionSimple(const Vertexes &C1, const Vertexes &C2)
+{
+    return areaUnionSimple(DecomposedPolygon(C1), DecomposedPolygon(C2));
+}
+double iouSimple(const Vertexes &C1, const Vertexes &C2)
+{
+    return iouSimple(DecomposedPolygon(C1), DecomposedPolygon(C2));
+}
+
+void iouSimpleBatch(const std::vector<DecomposedPolygon> &P1s, const std::vector<DecomposedPolygon> &P2s,
+                    std::vector<double> &ious)
+{
+    const int N = P1s.size();
+    const int M = P2s.size();
+    std::vector<double> _ious((size_t)N * M);
+    parallelFor(N, [&](int b, int e) {
+        for (int i = b; i < e; ++i) {
+            for (int j = 0; j < M; ++j)
+                _ious[(size_t)i * M + j] = iouSimple(P1s[i], P2s[j]);
+        }
+    });
+    ious.swap(_ious);
+}
+
+}
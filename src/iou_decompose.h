@@ -0,0 +1,69 @@
+/***********************************
+ * iou_decompose.h
+ *
+ * Intersection and iou of simple polygons, convex or not.
+ *
+ * A polygon is split once into convex pieces (ear clipping, then
+ * Hertel-Mehlhorn merging of the triangles), and the pieces are kept
+ * with their bounding boxes. The intersection of two polygons is the sum
+ * of the intersections of their pieces, skipping pieces whose boxes
+ * do not overlap.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#ifndef _IOU_DECOMPOSE_H_FILE_
+#define _IOU_DECOMPOSE_H_FILE_
+
+#include "iou.h"
+
+namespace IOU
+{
+    class DecomposedPolygon {
+    public:
+        // Constructors
+        DecomposedPolygon() : bValid(false), sArea(0.0) {}
+        // Either wise. Repeated and collinear vertexes are dropped.
+        explicit DecomposedPolygon(const Vertexes &C);
+
+        // Methods
+        // False for self-intersecting polygons and those of no area.
+        bool isValid() const { return bValid; }
+        double area() const { return sArea; }
+        // Convex pieces in anticlockwise, not overlapping.
+        int pieceCount() const { return pieces.size(); }
+        const Vertexes &piece(int i) const { return pieces[i]; }
+        // -1.0 if either polygon is not valid.
+        double areaIntersection(const DecomposedPolygon &other) const;
+
+    private:
+        struct Box {
+            double x0, x1, y0, y1;
+            bool overlaps(const Box &b) const {
+                return x0 < b.x1 && b.x0 < x1 && y0 < b.y1 && b.y0 < y1; }
+        };
+        std::vector<Vertexes> pieces;
+        std::vector<Box> boxes;  // Of each piece.
+        Box box;                 // Of the whole polygon.
+        bool bValid;
+        double sArea;
+    };
+
+    // For any simple polygon, -1.0 if self-intersecting.
+    // The Vertexes versions decompose the polygons on every call,
+    // keep DecomposedPolygon objects to query the same polygon again.
+    double areaIntersectionSimple(const DecomposedPolygon &P1, const DecomposedPolygon &P2);
+    double areaUnionSimple(const DecomposedPolygon &P1, const DecomposedPolygon &P2);
+    double iouSimple(const DecomposedPolygon &P1, const DecomposedPolygon &P2);
+    double areaIntersectionSimple(const Vertexes &C1, const Vertexes &C2);
+    double areaUnionSimple(const Vertexes &C1, const Vertexes &C2);
+    double iouSimple(const Vertexes &C1, const Vertexes &C2);
+
+    // Iou of all pairs, in parallel.
+    // ious is resized to P1s.size() x P2s.size(), in row-major order.
+    void iouSimpleBatch(const std::vector<DecomposedPolygon> &P1s, const std::vector<DecomposedPolygon> &P2s,
+                        std::vector<double> &ious);
+}
+#endif // !_IOU_DECOMPOSE_H_FILE_
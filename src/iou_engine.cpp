@@ -0,0 +1,609 @@
+/***********************************
+ * iou_engine.cpp
+ *
+ * Intersection and iou with the implementation picked per input.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "iou_engine.h"
+#include "iou_clip.h"
+#include "iou_parallel.h"
+#include <chrono>
+#include <climits>
+#include <mutex>
+
+namespace IOU
+{
+
+// Quad pairs sent to the SIMD kernel at once.
+static const int SIMD_CHUNK = 1 << 16;
+// Largest batch tried by the calibration.
+static const int CALIB_PAIRS = 256;
+// Relative tolerance of the right angles of a rectangle. The rectangle
+// engine clips by the exact rectangle, so it is kept small.
+static const double RECT_TOL = 1e-9;
+
+// A polygon prepared once: its kind, its vertexes in anticlockwise,
+// its area and its bounding box. Boxes and rectangles also keep their
+// frame: the corner o, the unit vector u along the first edge, and the
+// extents w along u and h across it.
+struct Shape {
+    ShapeKind kind;
+    Vertexes vert;
+    double area;
+    double x0, x1, y0, y1;
+    Point o, u;
+    double w, h;
+};
+
+static bool isQuadKind(const ShapeKind kind)
+{
+    return kind == ShapeAxisBox || kind == ShapeRectangle || kind == ShapeQuad;
+}
+static bool isFrameKind(const ShapeKind kind)
+{
+    return kind == ShapeAxisBox || kind == ShapeRectangle;
+}
+
+static ShapeKind classify(const Vertexes &C, const bool bConvex)
+{
+    if (!bConvex)
+        return ShapeNonConvex;
+    if (C.size() != 4)
+        return ShapePolygon;
+
+    bool bAxis = true;
+    bool bRect = true;
+    for (int i = 0; i < 4; ++i) {
+        const Point e0 = C[(i + 1) % 4] - C[i];
+        const Point e1 = C[(i + 2) % 4] - C[(i + 1) % 4];
+        // Exact, so the closed form gives the same area as clipping.
+        if (!(e0.x == 0.0 && e1.y == 0.0) && !(e0.y == 0.0 && e1.x == 0.0))
+            bAxis = false;
+        if (abs(e0*e1) > RECT_TOL * e0.norm() * e1.norm())
+            bRect = false;
+    }
+    if (bAxis)
+        return ShapeAxisBox;
+    return bRect ? ShapeRectangle : ShapeQuad;
+}
+
+static void prepareShape(const Vertexes &C, Shape &s)
+{
+    // Reversing keeps a convex polygon convex, no need to sort by angle.
+    const Vertexes *pC = 0;
+    s.kind = classify(C, antiClockWise(C, s.vert, &pC));
+    s.area = 0.0;
+    s.x0 = s.x1 = s.y0 = s.y1 = 0.0;
+    if (s.kind == ShapeNonConvex) {
+        s.vert.clear();
+        return;
+    }
+    if (pC == &C)
+        s.vert = C;
+    const int N = s.vert.size();
+    s.x0 = s.x1 = s.vert[0].x;
+    s.y0 = s.y1 = s.vert[0].y;
+    for (int i = 0; i < N; ++i) {
+        const Point &p = s.vert[i];
+        s.x0 = std::min(s.x0, p.x);
+        s.x1 = std::max(s.x1, p.x);
+        s.y0 = std::min(s.y0, p.y);
+        s.y1 = std::max(s.y1, p.y);
+        s.area += (p - s.vert[0]) ^ (s.vert[(i + 1) % N] - s.vert[0]);
+    }
+    s.area *= 0.5;
+
+    if (s.kind == ShapeAxisBox) {
+        s.o = Point(s.x0, s.y0);
+        s.u = Point(1.0, 0.0);
+        s.w = s.x1 - s.x0;
+        s.h = s.y1 - s.y0;
+    }
+    else if (s.kind == ShapeRectangle) {
+        s.o = s.vert[0];
+        s.w = (s.vert[1] - s.vert[0]).norm();
+        s.u = (s.vert[1] - s.vert[0]) / s.w;
+        s.h = (s.vert[2] - s.vert[1]).norm();
+    }
+}
+
+// Keep the part of buf0 where SIGN * (p.x - c) >= 0, or p.y if AXIS is 1.
+template <int AXIS, int SIGN>
+static void clipSlab(Vertexes &buf0, Vertexes &buf1, const double c)
+{
+    const int N = buf0.size();
+    buf1.clear();
+    for (int i = 0; i < N; ++i) {
+        const Point &p0 = buf0[i];
+        const Point &p1 = buf0[i + 1 < N ? i + 1 : 0];
+        const double d0 = SIGN * ((AXIS ? p0.y : p0.x) - c);
+        const double d1 = SIGN * ((AXIS ? p1.y : p1.x) - c);
+        if (d0 >= 0.0)
+            buf1.push_back(p0);
+        if ((d0 >= 0.0) != (d1 >= 0.0))
+            buf1.push_back(p0 + (p1 - p0) * (d0 / (d0 - d1)));
+    }
+    buf0.swap(buf1);
+}
+
+// Area of the intersection of the box or rectangle f with the convex
+// polygon s. s is moved into the frame of f, where f is [0, w] x [0, h],
+// and clipped by comparing coordinates only. The frame of a box is not
+// rotated, so its coordinates are only shifted.
+static double frameArea(const Shape &f, const Shape &s, Vertexes &buf0, Vertexes &buf1)
+{
+    const int N = s.vert.size();
+    buf0.resize(N);
+    for (int i = 0; i < N; ++i) {
+        const Point d = s.vert[i] - f.o;
+        buf0[i] = Point(d * f.u, f.u ^ d);
+    }
+    clipSlab<0, 1>(buf0, buf1, 0.0);
+    if (buf0.size() > 2)
+        clipSlab<0, -1>(buf0, buf1, f.w);
+    if (buf0.size() > 2)
+        clipSlab<1, 1>(buf0, buf1, 0.0);
+    if (buf0.size() > 2)
+        clipSlab<1, -1>(buf0, buf1, f.h);
+
+    const int M = buf0.size();
+    if (M < 3)
+        return 0.0;
+    double sArea = 0.0;
+    for (int i = 1; i < M - 1; ++i)
+        sArea += (buf0[i] - buf0[0]) ^ (buf0[i + 1] - buf0[0]);
+    return std::max(0.0, sArea * 0.5);
+}
+
+static Engine engineOf(const ShapeKind kind1, const ShapeKind kind2, const bool bSimd)
+{
+    if (kind1 == ShapeNonConvex || kind2 == ShapeNonConvex)
+        return EngineNone;
+    if (kind1 == ShapeAxisBox && kind2 == ShapeAxisBox)
+        return EngineAxisBox;
+    if (bSimd && isQuadKind(kind1) && isQuadKind(kind2))
+        return EngineQuadSimd;
+    if (isFrameKind(kind1) || isFrameKind(kind2))
+        return EngineRectClip;
+    return EngineConvexClip;
+}
+
+// Pairs with a box or a rectangle, against the others, for the SIMD thresholds.
+static bool isFramePair(const Shape &a, const Shape &b)
+{
+    return isFrameKind(a.kind) || isFrameKind(b.kind);
+}
+
+static bool boxesOverlap(const Shape &a, const Shape &b)
+{
+    return a.x0 < b.x1 && b.x0 < a.x1 && a.y0 < b.y1 && b.y0 < a.y1;
+}
+
+// Intersection in double precision, by the engine of the kinds.
+static double interPair(const Shape &a, const Shape &b, Vertexes &buf0, Vertexes &buf1)
+{
+    if (!boxesOverlap(a, b))
+        return engineOf(a.kind, b.kind, false) == EngineNone ? -1.0 : 0.0;
+    switch (engineOf(a.kind, b.kind, false)) {
+    case EngineAxisBox:
+        return (std::min(a.x1, b.x1) - std::max(a.x0, b.x0)) *
+               (std::min(a.y1, b.y1) - std::max(a.y0, b.y0));
+    case EngineRectClip:
+        // A box frame is exact, so it is taken before a rotated one.
+        if (a.kind == ShapeAxisBox || (a.kind == ShapeRectangle && b.kind != ShapeAxisBox))
+            return frameArea(a, b, buf0, buf1);
+        return frameArea(b, a, buf0, buf1);
+    case EngineConvexClip:
+        return clipAreaConvex(a.vert, b.vert, buf0, buf1);
+    default:
+        return -1.0;
+    }
+}
+
+static double iouOf(const double inter, const Shape &a, const Shape &b)
+{
+    if (inter < 0.0)
+        return -1.0;
+    const double uni = a.area + b.area - inter;
+    return uni > 0.0 ? inter / uni : 0.0;
+}
+
+// Iou of the quad pairs (as[k], bs[k]) by the SIMD kernel.
+// Each pair is moved next to the origin in double precision first, so
+// single precision only has to hold the local coordinates.
+// Pairs the kernel rejects in single precision are redone by clipping.
+static void quadSimdIous(const std::vector<const Shape *> &as, const std::vector<const Shape *> &bs,
+                         double *ious)
+{
+    const int N = as.size();
+    QuadBatch Q1s, Q2s;
+    for (int k = 0; k < 4; ++k) {
+        Q1s.x[k].resize(N);
+        Q1s.y[k].resize(N);
+        Q2s.x[k].resize(N);
+        Q2s.y[k].resize(N);
+    }
+    for (int i = 0; i < N; ++i) {
+        const Point o = as[i]->vert[0];
+        for (int k = 0; k < 4; ++k) {
+            const Point p1 = as[i]->vert[k] - o;
+            const Point p2 = bs[i]->vert[k] - o;
+            Q1s.x[k][i] = (float)p1.x;
+            Q1s.y[k][i] = (float)p1.y;
+            Q2s.x[k][i] = (float)p2.x;
+            Q2s.y[k][i] = (float)p2.y;
+        }
+    }
+    std::vector<float> res;
+    iouBatch(Q1s, Q2s, res);
+
+    Vertexes buf0, buf1;
+    for (int i = 0; i < N; ++i) {
+        ious[i] = res[i] >= 0.0f ? (double)res[i]
+                                 : iouOf(interPair(*as[i], *bs[i], buf0, buf1), *as[i], *bs[i]);
+    }
+}
+
+// Run the collected quad pairs through the SIMD kernel, write their iou
+// to ious[idx[k]], and empty the lists for the next chunk.
+// iouBatch() splits each chunk between threads.
+static void flushQuadSimd(std::vector<const Shape *> &as, std::vector<const Shape *> &bs,
+                          std::vector<size_t> &idx, std::vector<double> &ious)
+{
+    if (idx.empty())
+        return;
+    std::vector<double> res(idx.size());
+    quadSimdIous(as, bs, &res[0]);
+    for (int k = 0; k < (int)idx.size(); ++k)
+        ious[idx[k]] = res[k];
+    as.clear();
+    bs.clear();
+    idx.clear();
+}
+
+//---------------
+// Calibration.
+
+// Time per pair of func(), which runs nPairs pairs, in ns.
+template <typename Func>
+static double timePerPair(Func func, const int nPairs)
+{
+    typedef std::chrono::steady_clock Clock;
+    for (int reps = 1; ; reps *= 4) {
+        const Clock::time_point t0 = Clock::now();
+        for (int r = 0; r < reps; ++r)
+            func();
+        const double ns = std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+        if (ns > 2e5 || reps >= (1 << 16))
+            return ns / reps / nPairs;
+    }
+}
+
+// Overlapping pairs of boxes, rectangles or quads with various sizes and angles.
+static void calibrationShapes(const ShapeKind kind1, const ShapeKind kind2,
+                              std::vector<Shape> &S1, std::vector<Shape> &S2)
+{
+    S1.resize(CALIB_PAIRS);
+    S2.resize(CALIB_PAIRS);
+    for (int k = 0; k < CALIB_PAIRS; ++k) {
+        for (int s = 0; s < 2; ++s) {
+            const ShapeKind kind = s == 0 ? kind1 : kind2;
+            const double t = kind == ShapeAxisBox ? 0.0 : 0.37 * k + 1.1 * s;
+            const double w = 10.0 + (k * 7 + s * 3) % 11;
+            const double h = 6.0 + (k * 5 + s * 7) % 13;
+            const Point c(100.0 + k + 3.0 * s, 50.0 + 0.5 * k - 2.0 * s);
+            const Point u(cos(t) * w / 2.0, sin(t) * w / 2.0);
+            const Point v(-sin(t) * h / 2.0, cos(t) * h / 2.0);
+            Vertexes C;
+            C.push_back(c - u - v);
+            C.push_back(c + u - v);
+            C.push_back(kind == ShapeQuad ? c + (u + v) * 1.3 : c + u + v);
+            C.push_back(c - u + v);
+            prepareShape(C, s == 0 ? S1[k] : S2[k]);
+        }
+    }
+}
+
+static void calibrate(DispatchPlan &plan)
+{
+    plan.isa = simdIsa();
+    plan.nThreads = numThreads();
+    volatile double sink = 0.0;
+    Vertexes buf0, buf1;
+
+    std::vector<Shape> S1, S2;
+    auto timeDouble = [&]() {
+        return timePerPair([&]() {
+            for (int k = 0; k < CALIB_PAIRS; ++k)
+                sink = sink + iouOf(interPair(S1[k], S2[k], buf0, buf1), S1[k], S2[k]);
+        }, CALIB_PAIRS);
+    };
+    calibrationShapes(ShapeAxisBox, ShapeAxisBox, S1, S2);
+    plan.nsAxisBox = timeDouble();
+    calibrationShapes(ShapeRectangle, ShapeQuad, S1, S2);
+    plan.nsRectClip = timeDouble();
+    calibrationShapes(ShapeQuad, ShapeQuad, S1, S2);
+    plan.nsConvexClip = timeDouble();
+
+    // Smallest batches where the SIMD kernel, packing included, beats
+    // each engine it replaces. Its own cost does not depend on the kinds.
+    std::vector<const Shape *> as, bs;
+    std::vector<double> ious(CALIB_PAIRS);
+    plan.simdMinPairs = INT_MAX;
+    plan.simdMinRectPairs = INT_MAX;
+    plan.nsQuadSimd = 0.0;
+    for (int n = 1; n <= CALIB_PAIRS; n *= 2) {
+        as.clear();
+        bs.clear();
+        for (int k = 0; k < n; ++k) {
+            as.push_back(&S1[k]);
+            bs.push_back(&S2[k]);
+        }
+        const double ns = timePerPair([&]() {
+            quadSimdIous(as, bs, &ious[0]);
+        }, n);
+        plan.nsQuadSimd = ns;
+        if (ns < plan.nsConvexClip && plan.simdMinPairs == INT_MAX)
+            plan.simdMinPairs = n;
+        if (ns < plan.nsRectClip && plan.simdMinRectPairs == INT_MAX)
+            plan.simdMinRectPairs = n;
+    }
+
+    // Splitting pays off once the pairs outweigh starting the threads.
+    plan.parallelMinPairs = INT_MAX;
+    if (plan.nThreads > 1) {
+        // Even if the first call comes from inside a parallel block.
+        detail::ParallelScope scope(false);
+        const double nsStart = timePerPair([&]() {
+            parallelFor(plan.nThreads, [&](int b, int e) {
+                sink = sink + b + e;
+            }, 1);
+        }, 1);
+        const double nsPair = std::max(1.0, std::min(plan.nsQuadSimd, std::min(plan.nsRectClip, plan.nsConvexClip)));
+        plan.parallelMinPairs = (int)std::min(1e9, std::max(1.0, 4.0 * nsStart / nsPair));
+    }
+    plan.bCalibrated = true;
+}
+
+static std::once_flag _plan_once;
+static std::mutex _plan_mutex;
+static DispatchPlan _plan;
+
+DispatchPlan dispatchPlan()
+{
+    std::call_once(_plan_once, []() {
+        DispatchPlan plan;
+        calibrate(plan);
+        std::lock_guard<std::mutex> lock(_plan_mutex);
+        _plan = plan;
+    });
+    std::lock_guard<std::mutex> lock(_plan_mutex);
+    return _plan;
+}
+void setDispatchPlan(const DispatchPlan &plan)
+{
+    // A plan set before the first use replaces the calibration.
+    std::call_once(_plan_once, []() {});
+    std::lock_guard<std::mutex> lock(_plan_mutex);
+    _plan = plan;
+}
+
+Engine dispatchEngine(const ShapeKind kind1, const ShapeKind kind2, const int nQuadPairs)
+{
+    const DispatchPlan plan = dispatchPlan();
+    const bool bFrame = isFrameKind(kind1) || isFrameKind(kind2);
+    return engineOf(kind1, kind2, nQuadPairs >= (bFrame ? plan.simdMinRectPairs : plan.simdMinPairs));
+}
+
+//---------------
+ShapeKind shapeKind(const Vertexes &C)
+{
+    return classify(C, whichWiseEx(C) != NoneWise);
+}
+const char *shapeKindName(const ShapeKind kind)
+{
+    switch (kind) {
+    case ShapeAxisBox:
+        return "AxisBox";
+    case ShapeRectangle:
+        return "Rectangle";
+    case ShapeQuad:
+        return "Quad";
+    case ShapePolygon:
+        return "Polygon";
+    default:
+        return "NonConvex";
+    }
+}
+const char *engineName(const Engine engine)
+{
+    switch (engine) {
+    case EngineAxisBox:
+        return "AxisBox";
+    case EngineRectClip:
+        return "RectClip";
+    case EngineQuadSimd:
+        return "QuadSimd";
+    case EngineConvexClip:
+        return "ConvexClip";
+    default:
+        return "None";
+    }
+}
+
+// Single pairs stay in double precision, the SIMD kernel only pays off in batches.
+double areaIntersectionAuto(const Vertexes &C1, const Vertexes &C2)
+{
+    Shape a, b;
+    prepareShape(C1, a);
+    prepareShape(C2, b);
+    Vertexes buf0, buf1;
+    return interPair(a, b, buf0, buf1);
+}
+double iouAuto(const Vertexes &C1, const Vertexes &C2)
+{
+    Shape a, b;
+    prepareShape(C1, a);
+    prepareShape(C2, b);
+    Vertexes buf0, buf1;
+    return iouOf(interPair(a, b, buf0, buf1), a, b);
+}
+
+void iouAutoBatch(const std::vector<Vertexes> &C1s, const std::vector<Vertexes> &C2s,
+                  std::vector<double> &ious)
+{
+    const int N = C1s.size();
+    const int M = C2s.size();
+    std::vector<double> _ious((size_t)N * M, -1.0);
+
+    std::vector<Shape> S1(N), S2(M);
+    parallelFor(N, [&](int b, int e) {
+        for (int i = b; i < e; ++i)
+            prepareShape(C1s[i], S1[i]);
+    });
+    parallelFor(M, [&](int b, int e) {
+        for (int j = b; j < e; ++j)
+            prepareShape(C2s[j], S2[j]);
+    });
+
+    // Quad pairs whose boxes overlap go to the SIMD kernel, if there are
+    // enough of them; the others are cheap or need double precision.
+    const DispatchPlan plan = dispatchPlan();
+    const int grain = (long long)N * M >= plan.parallelMinPairs ? 0 : N;
+    auto bDeferred = [&](int i, int j) {
+        return engineOf(S1[i].kind, S2[j].kind, true) == EngineQuadSimd &&
+               boxesOverlap(S1[i], S2[j]);
+    };
+    std::vector<int> nDeferred(N, 0), nFrameDeferred(N, 0);
+    parallelFor(N, [&](int b, int e) {
+        Vertexes buf0, buf1;
+        for (int i = b; i < e; ++i) {
+            double *iouRow = &_ious[(size_t)i * M];
+            for (int j = 0; j < M; ++j) {
+                if (bDeferred(i, j)) {
+                    ++nDeferred[i];
+                    nFrameDeferred[i] += isFramePair(S1[i], S2[j]);
+                }
+                else {
+                    iouRow[j] = iouOf(interPair(S1[i], S2[j], buf0, buf1), S1[i], S2[j]);
+                }
+            }
+        }
+    }, grain);
+    // The SIMD kernel is used for each group of pairs large enough to pay off.
+    long long nFramePairs = 0, nQuadPairs = 0;
+    for (int i = 0; i < N; ++i) {
+        nFramePairs += nFrameDeferred[i];
+        nQuadPairs += nDeferred[i] - nFrameDeferred[i];
+    }
+    const bool bSimdFrame = nFramePairs >= plan.simdMinRectPairs;
+    const bool bSimdQuad = nQuadPairs >= plan.simdMinPairs;
+    auto bSimd = [&](int i, int j) {
+        return isFramePair(S1[i], S2[j]) ? bSimdFrame : bSimdQuad;
+    };
+
+    if (!bSimdFrame || !bSimdQuad) {
+        parallelFor(N, [&](int b, int e) {
+            Vertexes buf0, buf1;
+            for (int i = b; i < e; ++i) {
+                double *iouRow = &_ious[(size_t)i * M];
+                for (int j = 0; j < M && nDeferred[i] > 0; ++j) {
+                    if (bDeferred(i, j) && !bSimd(i, j))
+                        iouRow[j] = iouOf(interPair(S1[i], S2[j], buf0, buf1), S1[i], S2[j]);
+                }
+            }
+        }, grain);
+    }
+    if (bSimdFrame || bSimdQuad) {
+        std::vector<const Shape *> as, bs;
+        std::vector<size_t> idx;
+        for (int i = 0; i < N; ++i) {
+            for (int j = 0; j < M && nDeferred[i] > 0; ++j) {
+                if (!bDeferred(i, j) || !bSimd(i, j))
+                    continue;
+                as.push_back(&S1[i]);
+                bs.push_back(&S2[j]);
+                idx.push_back((size_t)i * M + j);
+                if ((int)idx.size() == SIMD_CHUNK)
+                    flushQuadSimd(as, bs, idx, _ious);
+            }
+        }
+        flushQuadSimd(as, bs, idx, _ious);
+    }
+    ious.swap(_ious);
+}
+
+
+void iouAutoPairs(const std::vector<const Vertexes *> &C1s, const std::vector<const Vertexes *> &C2s,
+                  const std::vector<std::pair<int, int> > &pairs, std::vector<double> &ious)
+{
+    const int N = C1s.size();
+    const int M = C2s.size();
+    const int P = pairs.size();
+    std::vector<double> _ious(P, -1.0);
+
+    std::vector<Shape> S1(N), S2(M);
+    parallelFor(N, [&](int b, int e) {
+        for (int i = b; i < e; ++i)
+            prepareShape(*C1s[i], S1[i]);
+    });
+    parallelFor(M, [&](int b, int e) {
+        for (int j = b; j < e; ++j)
+            prepareShape(*C2s[j], S2[j]);
+    });
+
+    // As iouAutoBatch(), pair by pair.
+    const DispatchPlan plan = dispatchPlan();
+    const int grain = P >= plan.parallelMinPairs ? 0 : P;
+    // bDeferred[k] is 1 for a quad pair, 2 for a quad pair with a box or a rectangle.
+    std::vector<char> bDeferred(P, 0);
+    parallelFor(P, [&](int b, int e) {
+        Vertexes buf0, buf1;
+        for (int k = b; k < e; ++k) {
+            const Shape &s1 = S1[pairs[k].first];
+            const Shape &s2 = S2[pairs[k].second];
+            if (engineOf(s1.kind, s2.kind, true) == EngineQuadSimd && boxesOverlap(s1, s2))
+                bDeferred[k] = isFramePair(s1, s2) ? 2 : 1;
+            else
+                _ious[k] = iouOf(interPair(s1, s2, buf0, buf1), s1, s2);
+        }
+    }, grain);
+    const bool bSimdQuad = std::count(bDeferred.begin(), bDeferred.end(), 1) >= plan.simdMinPairs;
+    const bool bSimdFrame = std::count(bDeferred.begin(), bDeferred.end(), 2) >= plan.simdMinRectPairs;
+    auto bSimd = [&](int k) {
+        return bDeferred[k] == 2 ? bSimdFrame : bSimdQuad;
+    };
+
+    if (!bSimdFrame || !bSimdQuad) {
+        parallelFor(P, [&](int b, int e) {
+            Vertexes buf0, buf1;
+            for (int k = b; k < e; ++k) {
+                const Shape &s1 = S1[pairs[k].first];
+                const Shape &s2 = S2[pairs[k].second];
+                if (bDeferred[k] && !bSimd(k))
+                    _ious[k] = iouOf(interPair(s1, s2, buf0, buf1), s1, s2);
+            }
+        }, grain);
+    }
+    if (bSimdFrame || bSimdQuad) {
+        std::vector<const Shape *> as, bs;
+        std::vector<size_t> idx;
+        for (int k = 0; k < P; ++k) {
+            if (!bDeferred[k] || !bSimd(k))
+                continue;
+            as.push_back(&S1[pairs[k].first]);
+            bs.push_back(&S2[pairs[k].second]);
+            idx.push_back(k);
+            if ((int)idx.size() == SIMD_CHUNK)
+                flushQuadSimd(as, bs, idx, _ious);
+        }
+        flushQuadSimd(as, bs, idx, _ious);
+    }
+    ious.swap(_ious);
+}
+
+}
@@ -0,0 +1,83 @@
+/***********************************
+ * iou_engine.h
+ *
+ * Intersection and iou with the implementation picked per input.
+ *
+ * Each polygon is classified once (axis-aligned box, rectangle, quad,
+ * other convex polygon), and each pair goes to the fastest engine for
+ * its kinds: a closed form for two axis-aligned boxes, clipping by the
+ * four sides of a box or a rectangle in its own frame, the SIMD quad
+ * kernel for batches of quad pairs, and a convex clipper otherwise.
+ * The thresholds between engines are measured on the current CPU
+ * the first time they are needed, for each kind of pair.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#ifndef _IOU_ENGINE_H_FILE_
+#define _IOU_ENGINE_H_FILE_
+
+#include "iou.h"
+#include "iou_simd.h"
+
+namespace IOU
+{
+    enum ShapeKind
+    {
+        ShapeNonConvex,  // Not convex, or less than 3 vertexes.
+        ShapeAxisBox,    // Rectangle with axis-aligned edges.
+        ShapeRectangle,  // Rotated rectangle.
+        ShapeQuad,       // Any other convex quadrilateral.
+        ShapePolygon     // Convex polygon of 3, or more than 4 vertexes.
+    };
+    ShapeKind shapeKind(const Vertexes &C);
+    const char *shapeKindName(const ShapeKind kind);
+
+    enum Engine
+    {
+        EngineNone,        // Non-convex input, the result is -1.0.
+        EngineAxisBox,     // Closed form on the bounding boxes.
+        EngineRectClip,    // Clip the other polygon by a box or rectangle, in its frame.
+        EngineQuadSimd,    // iouBatch() of iou_simd.h, in single precision.
+        EngineConvexClip   // Clip one polygon by the other's edges, in double precision.
+    };
+    const char *engineName(const Engine engine);
+
+    // What the dispatch chose, and why.
+    struct DispatchPlan {
+        SimdIsa isa;            // simdIsa() at calibration.
+        int nThreads;           // numThreads() at calibration.
+        int simdMinPairs;       // Quad pairs in one batch from which EngineQuadSimd is used.
+        int simdMinRectPairs;   // The same, for quad pairs with a box or a rectangle.
+        int parallelMinPairs;   // Pairs in one batch from which the work is split between threads.
+        double nsAxisBox;       // Measured time per pair, 0 if not calibrated.
+        double nsRectClip;
+        double nsQuadSimd;
+        double nsConvexClip;
+        bool bCalibrated;
+    };
+    // Calibrates on the first call, in a few milliseconds.
+    DispatchPlan dispatchPlan();
+    // Replace the plan, e.g. simdMinPairs = simdMinRectPairs = INT_MAX keeps every
+    // pair in double precision.
+    void setDispatchPlan(const DispatchPlan &plan);
+    // Engine of a pair of these kinds, in a batch with nQuadPairs quad pairs like it
+    // (with or without a box or a rectangle).
+    Engine dispatchEngine(const ShapeKind kind1, const ShapeKind kind2, const int nQuadPairs = 1);
+
+    // Same results as areaIntersectionEx() and iouEx(), -1.0 for non-convex polygons.
+    double areaIntersectionAuto(const Vertexes &C1, const Vertexes &C2);
+    double iouAuto(const Vertexes &C1, const Vertexes &C2);
+
+    // Iou of all pairs, each polygon classified once.
+    // ious is resized to C1s.size() x C2s.size(), in row-major order.
+    void iouAutoBatch(const std::vector<Vertexes> &C1s, const std::vector<Vertexes> &C2s,
+                      std::vector<double> &ious);
+    // Iou of the pairs (*C1s[pairs[k].first], *C2s[pairs[k].second]), each polygon
+    // classified once however many pairs it is in. ious is resized to pairs.size().
+    void iouAutoPairs(const std::vector<const Vertexes *> &C1s, const std::vector<const Vertexes *> &C2s,
+                      const std::vector<std::pair<int, int> > &pairs, std::vector<double> &ious);
+}
+#endif // !_IOU_ENGINE_H_FILE_
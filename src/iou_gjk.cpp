@@ -0,0 +1,347 @@
+/***********************************
+ * iou_gjk.cpp
+ *
+ * Distance and penetration depth of two convex polygons.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "iou_gjk.h"
+#include "iou_clip.h"
+#include "iou_ingest.h"
+#include "iou_parallel.h"
+#include <algorithm>
+
+namespace IOU
+{
+
+static const int GJK_MAX_ITER = 64;
+static const int EPA_MAX_ITER = 64;
+
+// Minkowski difference A - B of two convex point lists.
+class MinkowskiDiff {
+public:
+    MinkowskiDiff(const Point *_a, int _na, const Point *_b, int _nb)
+        : a(_a), na(_na), b(_b), nb(_nb) {}
+
+    // Farthest point along d.
+    Point support(const Point &d) const {
+        return a[farthest(a, na, d)] - b[farthest(b, nb, d * -1.0)]; }
+    Point any() const { return a[0] - b[0]; }
+    void allPoints(Vertexes &pts) const {
+        Vertexes _pts;
+        _pts.reserve(na * nb);
+        for (int i = 0; i < na; ++i)
+            for (int j = 0; j < nb; ++j)
+                _pts.push_back(a[i] - b[j]);
+        pts.swap(_pts);
+    }
+
+private:
+    const Point *a;
+    int na;
+    const Point *b;
+    int nb;
+
+    static int farthest(const Point *p, int n, const Point &d) {
+        int k = 0;
+        double best = p[0] * d;
+        for (int i = 1; i < n; ++i) {
+            const double v = p[i] * d;
+            if (v > best) {
+                best = v;
+                k = i;
+            }
+        }
+        return k;
+    }
+};
+
+struct Simplex {
+    Point p[3];
+    int n;
+};
+
+static Point closestOnSegment(const Point &a, const Point &b, double *t)
+{
+    const Point ab = b - a;
+    const double len2 = ab.normSquared();
+    double s = len2 > 0.0 ? -(a * ab) / len2 : 0.0;
+    s = std::max(0.0, std::min(1.0, s));
+    *t = s;
+    return a + ab * s;
+}
+
+// Closest point of the simplex to the origin.
+// The simplex is reduced to the feature holding that point.
+static Point closestOnSimplex(Simplex &s)
+{
+    if (s.n == 1)
+        return s.p[0];
+    if (s.n == 2) {
+        double t;
+        const Point c = closestOnSegment(s.p[0], s.p[1], &t);
+        if (t <= 0.0)
+            s.n = 1;
+        else if (t >= 1.0) {
+            s.p[0] = s.p[1];
+            s.n = 1;
+        }
+        return c;
+    }
+
+    // Triangle: the origin is inside if it is on the same side of all edges.
+    const Point &a = s.p[0], &b = s.p[1], &c = s.p[2];
+    const double area = (b - a) ^ (c - a);
+    const double wa = b ^ c;  // Twice the signed area of (O, b, c).
+    const double wb = c ^ a;
+    const double wc = a ^ b;
+    if (area != 0.0 &&
+        wa * area >= 0.0 && wb * area >= 0.0 && wc * area >= 0.0)
+        return Point(0.0, 0.0);
+
+    // Otherwise the closest point is on an edge.
+    Point best;
+    double bestD = -1.0;
+    int bestI = 0;
+    for (int i = 0; i < 3; ++i) {
+        double t;
+        const Point q = closestOnSegment(s.p[i], s.p[(i + 1) % 3], &t);
+        const double d = q.normSquared();
+        if (bestD < 0.0 || d < bestD) {
+            best = q;
+            bestD = d;
+            bestI = i;
+        }
+    }
+    const Point e0 = s.p[bestI];
+    const Point e1 = s.p[(bestI + 1) % 3];
+    s.p[0] = e0;
+    s.p[1] = e1;
+    s.n = 2;
+    double t;
+    closestOnSegment(e0, e1, &t);
+    if (t <= 0.0)
+        s.n = 1;
+    else if (t >= 1.0) {
+        s.p[0] = e1;
+        s.n = 1;
+    }
+    return best;
+}
+
+// GJK distance of the Minkowski difference to the origin.
+// Return 0 on overlap, with the final simplex in s.
+static double gjkDistance(const MinkowskiDiff &M, const double gate, Simplex &s)
+{
+    Point v = M.any();
+    s.p[0] = v;
+    s.n = 1;
+    for (int iter = 0; iter < GJK_MAX_ITER; ++iter) {
+        const double vv = v.normSquared();
+        if (vv <= EPS * EPS)
+            return 0.0;
+        const double vNorm = sqrt(vv);
+
+        const Point w = M.support(v * -1.0);
+        const double vw = v * w;
+        // The distance is at least v.w / |v|.
+        if (gate >= 0.0 && vw > gate * vNorm)
+            return vw / vNorm;
+        if (vNorm - vw / vNorm <= EPS)
+            return vNorm;
+
+        s.p[s.n++] = w;
+        v = closestOnSimplex(s);
+        if (s.n == 3)
+            return 0.0;
+    }
+    return v.norm();
+}
+
+// Depth as the closest edge of a convex polygon in anticlockwise
+// holding the origin.
+static double closestEdge(const Vertexes &poly, Point *normal, int *edge)
+{
+    const int N = poly.size();
+    double best = -1.0;
+    for (int i = 0; i < N; ++i) {
+        const Point e = poly[(i + 1) % N] - poly[i];
+        const double len = e.norm();
+        if (len <= EPS)
+            continue;
+        const Point n(e.y / len, -e.x / len);
+        const double d = n * poly[i];
+        if (best < 0.0 || d < best) {
+            best = d;
+            *normal = n;
+            *edge = i;
+        }
+    }
+    return best;
+}
+
+// EPA from the GJK simplex. Falls back to the exact Minkowski difference
+// when the simplex does not enclose the origin (touching or degenerate cases).
+static double epaDepth(const MinkowskiDiff &M, const Simplex &s, Point *normal)
+{
+    Point n(0.0, 0.0);
+    int edge = 0;
+    double depth = 0.0;
+
+    double area = 0.0;
+    if (s.n == 3)
+        area = (s.p[1] - s.p[0]) ^ (s.p[2] - s.p[0]);
+    if (abs(area) > EPS) {
+        Vertexes poly(s.p, s.p + 3);
+        if (area < 0.0)
+            std::swap(poly[1], poly[2]);
+        depth = closestEdge(poly, &n, &edge);
+        for (int iter = 0; depth > EPS && iter < EPA_MAX_ITER; ++iter) {
+            const Point w = M.support(n);
+            if (w * n - depth <= EPS)
+                break;
+            poly.insert(poly.begin() + edge + 1, w);
+            depth = closestEdge(poly, &n, &edge);
+        }
+    }
+    if (!(depth > EPS)) {
+        Vertexes pts, hull;
+        M.allPoints(pts);
+        convexHullEx(pts, hull);
+        depth = hull.size() >= 3 ? closestEdge(hull, &n, &edge) : 0.0;
+    }
+    if (depth <= 0.0) {
+        depth = 0.0;
+        n = Point(0.0, 0.0);
+    }
+    if (normal != 0)
+        *normal = n;
+    return depth;
+}
+
+static bool isConvexShape(const Point *p, int n)
+{
+    Vertexes C(p, p + n);
+    return n > 0 && whichWiseEx(C) != NoneWise;
+}
+
+static double gjkDistance(const Point *a, int na, const Point *b, int nb, const double gate)
+{
+    Simplex s;
+    return gjkDistance(MinkowskiDiff(a, na, b, nb), gate, s);
+}
+static double gjkSignedDistance(const Point *a, int na, const Point *b, int nb,
+                                const bool bDepthOnly, Point *normal)
+{
+    const MinkowskiDiff M(a, na, b, nb);
+    Simplex s;
+    const double d = gjkDistance(M, -1.0, s);
+    if (d > EPS) {
+        if (normal != 0)
+            *normal = Point(0.0, 0.0);
+        return bDepthOnly ? 0.0 : d;
+    }
+    return -epaDepth(M, s, normal);
+}
+
+double distanceEx(const Vertexes &C1, const Vertexes &C2, const double gate)
+{
+    if (whichWiseEx(C1) == NoneWise || whichWiseEx(C2) == NoneWise)
+        return -1.0;
+    return gjkDistance(&C1[0], C1.size(), &C2[0], C2.size(), gate);
+}
+double penetrationDepthEx(const Vertexes &C1, const Vertexes &C2, Point *normal)
+{
+    if (whichWiseEx(C1) == NoneWise || whichWiseEx(C2) == NoneWise)
+        return -1.0;
+    return -gjkSignedDistance(&C1[0], C1.size(), &C2[0], C2.size(), true, normal);
+}
+double signedDistanceEx(const Vertexes &C1, const Vertexes &C2)
+{
+    if (whichWiseEx(C1) == NoneWise || whichWiseEx(C2) == NoneWise)
+        return -1.0;
+    return gjkSignedDistance(&C1[0], C1.size(), &C2[0], C2.size(), false, 0);
+}
+
+double distance(const Quad &Q1, const Quad &Q2, const double gate)
+{
+    const Point a[4] = {Q1.p1, Q1.p2, Q1.p3, Q1.p4};
+    const Point b[4] = {Q2.p1, Q2.p2, Q2.p3, Q2.p4};
+    if (!isConvexShape(a, 4) || !isConvexShape(b, 4))
+        return -1.0;
+    return gjkDistance(a, 4, b, 4, gate);
+}
+double penetrationDepth(const Quad &Q1, const Quad &Q2, Point *normal)
+{
+    const Point a[4] = {Q1.p1, Q1.p2, Q1.p3, Q1.p4};
+    const Point b[4] = {Q2.p1, Q2.p2, Q2.p3, Q2.p4};
+    if (!isConvexShape(a, 4) || !isConvexShape(b, 4))
+        return -1.0;
+    return -gjkSignedDistance(a, 4, b, 4, true, normal);
+}
+double signedDistance(const Quad &Q1, const Quad &Q2)
+{
+    const Point a[4] = {Q1.p1, Q1.p2, Q1.p3, Q1.p4};
+    const Point b[4] = {Q2.p1, Q2.p2, Q2.p3, Q2.p4};
+    if (!isConvexShape(a, 4) || !isConvexShape(b, 4))
+        return -1.0;
+    return gjkSignedDistance(a, 4, b, 4, false, 0);
+}
+
+void iouGateBatch(const std::vector<Vertexes> &C1s, const std::vector<Vertexes> &C2s,
+                  const double gate,
+                  std::vector<double> &ious, std::vector<double> &dists)
+{
+    const int N = C1s.size();
+    const int M = C2s.size();
+    std::vector<double> _ious((size_t)N * M, 0.0);
+    std::vector<double> _dists((size_t)N * M, 0.0);
+
+    // Convexity and areas are checked once per polygon, not per pair,
+    // and clockwise polygons are reversed once for the clipper.
+    std::vector<double> area1(N), area2(M);
+    std::vector<Vertexes> ccw1(N), ccw2(M);
+    auto prepare = [](const std::vector<Vertexes> &Cs, std::vector<double> &areas,
+                      std::vector<Vertexes> &ccws) {
+        parallelFor(Cs.size(), [&](int b, int e) {
+            for (int i = b; i < e; ++i) {
+                const Vertexes *pC = 0;
+                areas[i] = antiClockWise(Cs[i], ccws[i], &pC) ? areaEx(Cs[i]) : -1.0;
+            }
+        });
+    };
+    prepare(C1s, area1, ccw1);
+    prepare(C2s, area2, ccw2);
+
+    parallelFor(N, [&](int b, int e) {
+        Vertexes buf0, buf1;
+        for (int i = b; i < e; ++i) {
+            double *iouRow = &_ious[(size_t)i * M];
+            double *distRow = &_dists[(size_t)i * M];
+            const Vertexes &P1 = ccw1[i].empty() ? C1s[i] : ccw1[i];
+            for (int j = 0; j < M; ++j) {
+                if (area1[i] < 0.0 || area2[j] < 0.0 ||
+                    C1s[i].empty() || C2s[j].empty()) {
+                    iouRow[j] = -1.0;
+                    distRow[j] = -1.0;
+                    continue;
+                }
+                const double d = gjkDistance(&C1s[i][0], C1s[i].size(),
+                                             &C2s[j][0], C2s[j].size(), gate);
+                distRow[j] = d;
+                if (d > 0.0)
+                    continue;
+                const Vertexes &P2 = ccw2[j].empty() ? C2s[j] : ccw2[j];
+                const double inter = clipAreaConvex(P1, P2, buf0, buf1);
+                iouRow[j] = inter / (area1[i] + area2[j] - inter);
+            }
+        }
+    });
+    ious.swap(_ious);
+    dists.swap(_dists);
+}
+
+}
@@ -0,0 +1,44 @@
+/***********************************
+ * iou_gjk.h
+ *
+ * Distance and penetration depth of two convex polygons,
+ * by GJK (Gilbert-Johnson-Keerthi) and EPA (Expanding Polytope Algorithm)
+ * on their Minkowski difference.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#ifndef _IOU_GJK_H_FILE_
+#define _IOU_GJK_H_FILE_
+
+#include "iou.h"
+
+namespace IOU
+{
+    // Return -1.0 for non-convex polygons.
+
+    // Minimum distance, 0 if the polygons overlap or touch.
+    // With gate >= 0, stop as soon as the distance is known to exceed gate,
+    // and return a lower bound of it that is greater than gate.
+    double distanceEx(const Vertexes &C1, const Vertexes &C2, const double gate = -1.0);
+    // Penetration depth, 0 if the polygons do not overlap.
+    // normal receives the unit direction to move C2 along by depth to separate them.
+    double penetrationDepthEx(const Vertexes &C1, const Vertexes &C2, Point *normal = 0);
+    // Distance if apart, minus the penetration depth if overlapping.
+    double signedDistanceEx(const Vertexes &C1, const Vertexes &C2);
+
+    double distance(const Quad &Q1, const Quad &Q2, const double gate = -1.0);
+    double penetrationDepth(const Quad &Q1, const Quad &Q2, Point *normal = 0);
+    double signedDistance(const Quad &Q1, const Quad &Q2);
+
+    // Gating and iou of all pairs in one pass, in parallel.
+    // ious and dists are resized to C1s.size() x C2s.size(), in row-major order.
+    // Separated pairs get iou 0 without an intersection, and their distance
+    // is only resolved up to the gate, as with distanceEx().
+    void iouGateBatch(const std::vector<Vertexes> &C1s, const std::vector<Vertexes> &C2s,
+                      const double gate,
+                      std::vector<double> &ious, std::vector<double> &dists);
+}
+#endif // !_IOU_GJK_H_FILE_
@@ -0,0 +1,181 @@
+/***********************************
+ * iou_ingest.cpp
+ *
+ * Bulk preparation of incoming polygons, in parallel and in place.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "iou_ingest.h"
+#include "iou_parallel.h"
+#include <algorithm>
+
+namespace IOU
+{
+
+// Turn at vertex b, relative to the edge lengths, so the test does not
+// depend on the polygon size.
+static bool isStraight(const Point &a, const Point &b, const Point &c, bool *bBack)
+{
+    const Point e0 = b - a;
+    const Point e1 = c - b;
+    *bBack = e0*e1 < 0.0;
+    return abs(e0^e1) <= EPS * e0.norm() * e1.norm();
+}
+
+// Remove repeated vertexes, in place.
+static bool removeRepeated(Vertexes &C)
+{
+    const int N = C.size();
+    int n = 0;
+    for (int i = 0; i < N; ++i) {
+        if (n == 0 || !(C[i] == C[n - 1]))
+            C[n++] = C[i];
+    }
+    while (n > 1 && C[n - 1] == C[0])
+        --n;
+    C.resize(n);
+    return n < N;
+}
+
+// Remove vertexes in the middle of a straight edge, in place.
+// A vertex where the boundary turns back on itself is kept, it makes
+// the polygon non-convex.
+static bool removeStraight(Vertexes &C)
+{
+    bool bRemoved = false;
+    bool bChanged = true;
+    while (bChanged && C.size() >= 3) {
+        bChanged = false;
+        const int N = C.size();
+        int n = 0;
+        for (int i = 0; i < N; ++i) {
+            const Point &prev = n > 0 ? C[n - 1] : C[N - 1];
+            bool bBack = false;
+            if (isStraight(prev, C[i], C[(i + 1) % N], &bBack) && !bBack) {
+                bChanged = true;
+                continue;
+            }
+            C[n++] = C[i];
+        }
+        C.resize(n);
+        bRemoved = bRemoved || bChanged;
+    }
+    return bRemoved;
+}
+
+// Every turn to the left, and the edges going around once:
+// their x direction changes sign at most twice.
+static bool isStrictlyConvex(const Vertexes &C)
+{
+    const int N = C.size();
+    int nSwaps = 0;
+    double lastDx = 0.0;
+    for (int i = 0; i < N + 1; ++i) {
+        const Point &a = C[i % N];
+        const Point &b = C[(i + 1) % N];
+        const Point &c = C[(i + 2) % N];
+        bool bBack = false;
+        if (i < N && (((b - a)^(c - b)) <= 0.0 || isStraight(a, b, c, &bBack)))
+            return false;
+        const double dx = b.x - a.x;
+        if (dx != 0.0) {
+            if (lastDx != 0.0 && (dx > 0.0) != (lastDx > 0.0))
+                ++nSwaps;
+            lastDx = dx;
+        }
+    }
+    return nSwaps <= 2;
+}
+
+int ingestPolygon(Vertexes &C, const bool bRepair, const WiseType wise)
+{
+    int flags = 0;
+    if (removeRepeated(C))
+        flags |= IngestDeduplicated;
+
+    // Winding from the signed area, no sort needed.
+    const int N = C.size();
+    double s2 = 0.0;
+    for (int i = 0; i < N; ++i)
+        s2 += C[i] ^ C[(i + 1) % N];
+    if (s2 < 0.0)
+        std::reverse(C.begin(), C.end());
+    const bool bWasClockWise = s2 < 0.0;
+
+    if (removeStraight(C))
+        flags |= IngestStraightened;
+
+    if (C.size() < 3 || s2 == 0.0 || !isStrictlyConvex(C)) {
+        if (!bRepair || C.size() < 3) {
+            if (bWasClockWise)
+                std::reverse(C.begin(), C.end());
+            return flags | IngestInvalid;
+        }
+        Vertexes hull;
+        convexHullEx(C, hull);
+        removeStraight(hull);
+        if (hull.size() < 3) {
+            if (bWasClockWise)
+                std::reverse(C.begin(), C.end());
+            return flags | IngestInvalid;
+        }
+        C.swap(hull);
+        flags |= IngestRepaired;
+    }
+
+    if (wise == ClockWise)
+        std::reverse(C.begin(), C.end());
+    if (bWasClockWise != (wise == ClockWise))
+        flags |= IngestReversed;
+    return flags;
+}
+
+void ingestPolygons(std::vector<Vertexes> &Cs, IngestReport &report,
+                    const bool bRepair, const WiseType wise)
+{
+    const int N = Cs.size();
+    std::vector<int> _flags(N);
+    parallelFor(N, [&](int b, int e) {
+        for (int i = b; i < e; ++i)
+            _flags[i] = ingestPolygon(Cs[i], bRepair, wise);
+    });
+
+    report.nValid = report.nReversed = report.nCleaned = 0;
+    report.nRepaired = report.nInvalid = 0;
+    for (int i = 0; i < N; ++i) {
+        const int f = _flags[i];
+        report.nValid += (f & IngestInvalid) == 0;
+        report.nInvalid += (f & IngestInvalid) != 0;
+        report.nReversed += (f & IngestReversed) != 0;
+        report.nCleaned += (f & (IngestDeduplicated | IngestStraightened)) != 0;
+        report.nRepaired += (f & IngestRepaired) != 0;
+    }
+    report.flags.swap(_flags);
+}
+
+void convexHullEx(const Vertexes &pts, Vertexes &hull)
+{
+    Vertexes P(pts);
+    std::sort(P.begin(), P.end(), [](const Point &a, const Point &b) {
+        return a.x < b.x || (a.x == b.x && a.y < b.y); });
+    const int N = P.size();
+    Vertexes H(2 * N + 1);
+    int k = 0;
+    for (int i = 0; i < N; ++i) {
+        while (k >= 2 && ((H[k - 1] - H[k - 2]) ^ (P[i] - H[k - 2])) <= 0.0)
+            --k;
+        H[k++] = P[i];
+    }
+    for (int i = N - 2, t = k + 1; i >= 0; --i) {
+        while (k >= t && ((H[k - 1] - H[k - 2]) ^ (P[i] - H[k - 2])) <= 0.0)
+            --k;
+        H[k++] = P[i];
+    }
+    H.resize(k > 1 ? k - 1 : k);
+    hull.swap(H);
+}
+
+}
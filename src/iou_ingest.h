@@ -0,0 +1,52 @@
+/***********************************
+ * iou_ingest.h
+ *
+ * Bulk preparation of incoming polygons, in parallel and in place:
+ * repeated and straight vertexes removed, convexity checked, winding
+ * normalized, and non-convex polygons optionally replaced by their hull.
+ * Each polygon gets a status, so later stages need not check again.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#ifndef _IOU_INGEST_H_FILE_
+#define _IOU_INGEST_H_FILE_
+
+#include "iou.h"
+
+namespace IOU
+{
+    enum IngestFlag
+    {
+        IngestReversed = 1,      // Winding reversed.
+        IngestDeduplicated = 2,  // Repeated vertexes removed.
+        IngestStraightened = 4,  // Vertexes in the middle of a straight edge removed.
+        IngestRepaired = 8,      // Not convex, replaced by its convex hull.
+        IngestInvalid = 16       // Less than 3 vertexes, no area, or not convex and not repaired.
+    };
+
+    struct IngestReport {
+        std::vector<int> flags;  // IngestFlag bits of each polygon, 0 if kept as given.
+        int nValid;
+        int nReversed;
+        int nCleaned;            // Deduplicated or straightened.
+        int nRepaired;
+        int nInvalid;
+
+        bool isValid(int i) const { return (flags[i] & IngestInvalid) == 0; }
+    };
+
+    // Prepare all polygons in place, in parallel.
+    // Valid polygons come out strictly convex in the wise asked, so that
+    // whichWiseEx() accepts them. Invalid ones are left cleaned but not repaired.
+    void ingestPolygons(std::vector<Vertexes> &Cs, IngestReport &report,
+                        const bool bRepair = false, const WiseType wise = AntiClockWise);
+    // One polygon, returning its IngestFlag bits.
+    int ingestPolygon(Vertexes &C, const bool bRepair = false, const WiseType wise = AntiClockWise);
+
+    // Convex hull in anticlockwise, collinear points dropped (monotone chain).
+    void convexHullEx(const Vertexes &pts, Vertexes &hull);
+}
+#endif // !_IOU_INGEST_H_FILE_
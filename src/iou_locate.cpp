@@ -0,0 +1,109 @@
+/***********************************
+ * iou_locate.cpp
+ *
+ * Locate points in convex polygons in O(log n).
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "iou_locate.h"
+#include "iou_parallel.h"
+#include <algorithm>
+
+namespace IOU
+{
+
+ConvexLocator::ConvexLocator(const Vertexes &C)
+    : vert(C), bConvex(false), x0(0), x1(0), y0(0), y1(0), margin(0)
+{
+    const int N = vert.size();
+    const WiseType wiseType = whichWiseEx(vert);
+    if (wiseType == NoneWise || N < 3)
+        return;
+    bConvex = true;
+    if (wiseType == ClockWise)
+        std::reverse(vert.begin() + 1, vert.end());
+
+    x0 = x1 = vert[0].x;
+    y0 = y1 = vert[0].y;
+    for (int i = 0; i < N; ++i) {
+        x0 = std::min(x0, vert[i].x);
+        x1 = std::max(x1, vert[i].x);
+        y0 = std::min(y0, vert[i].y);
+        y1 = std::max(y1, vert[i].y);
+        // isOnEdge() bounds the cross product, i.e. distance times length.
+        const double len = vert[i].distance(vert[(i + 1) % N]);
+        margin = std::max(margin, len > EPS ? EPS / len : 1e300);
+    }
+}
+
+LocPosition ConvexLocator::location(const Point &p) const
+{
+    if (!bConvex)
+        return locationEx(vert, p);
+    if (p.x < x0 - margin || p.x > x1 + margin ||
+        p.y < y0 - margin || p.y > y1 + margin)
+        return Outside;
+
+    // Find the wedge V0-Vk-Vk+1 holding p, with 1 <= k <= N-2.
+    const int N = vert.size();
+    const Point &v0 = vert[0];
+    const Point d = p - v0;
+    int lo = 1, hi = N - 2;
+    while (lo < hi) {
+        const int mid = (lo + hi + 1) / 2;
+        if (((vert[mid] - v0) ^ d) >= 0.0)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    const int k = lo;
+
+    // The edges that p may be close to.
+    if (isOnEdgeAt(k - 1, p) || isOnEdgeAt(k, p) || isOnEdgeAt(k + 1, p) ||
+        isOnEdgeAt(0, p) || isOnEdgeAt(N - 1, p))
+        return OnEdge;
+
+    if (((vert[1] - v0) ^ d) < 0.0 || ((vert[N - 1] - v0) ^ d) > 0.0)
+        return Outside;
+    if (((vert[k + 1] - vert[k]) ^ (p - vert[k])) > 0.0)
+        return Inside;
+    return Outside;
+}
+
+void locationBatch(const Vertexes &C, const std::vector<Point> &pts,
+                   std::vector<LocPosition> &locs)
+{
+    const int N = pts.size();
+    std::vector<LocPosition> _locs(N);
+    const ConvexLocator locator(C);
+    parallelFor(N, [&](int b, int e) {
+        for (int i = b; i < e; ++i)
+            _locs[i] = locator.location(pts[i]);
+    });
+    locs.swap(_locs);
+}
+void locationBatch(const std::vector<Vertexes> &Cs, const std::vector<Point> &pts,
+                   std::vector<LocPosition> &locs)
+{
+    const int N = pts.size();
+    const int M = Cs.size();
+    std::vector<LocPosition> _locs((size_t)N * M);
+    std::vector<ConvexLocator> locators(M);
+    parallelFor(M, [&](int b, int e) {
+        for (int j = b; j < e; ++j)
+            locators[j] = ConvexLocator(Cs[j]);
+    });
+    parallelFor(N, [&](int b, int e) {
+        for (int i = b; i < e; ++i) {
+            LocPosition *row = &_locs[(size_t)i * M];
+            for (int j = 0; j < M; ++j)
+                row[j] = locators[j].location(pts[i]);
+        }
+    });
+    locs.swap(_locs);
+}
+
+}
@@ -0,0 +1,60 @@
+/***********************************
+ * iou_locate.h
+ *
+ * Locate points in convex polygons in O(log n).
+ * The polygon is prepared once, then each point is located by a
+ * binary search over the wedges around its first vertex.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#ifndef _IOU_LOCATE_H_FILE_
+#define _IOU_LOCATE_H_FILE_
+
+#include "iou.h"
+
+namespace IOU
+{
+    class ConvexLocator {
+    public:
+        // Constructors
+        ConvexLocator() : bConvex(false), x0(0), x1(0), y0(0), y1(0), margin(0) {}
+        ConvexLocator(const Vertexes &C);
+
+        // Methods
+        // Same result as locationEx(C, p), with the same OnEdge tolerance.
+        // Non-convex polygons fall back to locationEx().
+        LocPosition location(const Point &p) const;
+        bool isConvex() const { return bConvex; }
+
+    private:
+        Vertexes vert;   // In anticlockwise if convex, as given otherwise.
+        bool bConvex;
+        double x0, x1, y0, y1;
+        double margin;   // Largest distance counted as OnEdge.
+
+        // Line::isOnEdge() of edge i, without building the Line.
+        bool isOnEdgeAt(int i, const Point &p) const {
+            const int N = vert.size();
+            const Point &a = vert[(i + N) % N];
+            const Point &b = vert[(i + N + 1) % N];
+            if (a == b)
+                return (p == (a + b) / 2.0);
+            const Point pa = p - a;
+            const Point pb = p - b;
+            return abs(pa^pb) < EPS && pa*pb < EPS; }
+    };
+    inline LocPosition location(const ConvexLocator &locator, const Point &p) {
+        return locator.location(p); }
+
+    // Locate many points, in parallel.
+    // One polygon: locs is resized to pts.size().
+    // Many polygons: locs is resized to pts.size() x Cs.size(), in row-major order.
+    void locationBatch(const Vertexes &C, const std::vector<Point> &pts,
+                       std::vector<LocPosition> &locs);
+    void locationBatch(const std::vector<Vertexes> &Cs, const std::vector<Point> &pts,
+                       std::vector<LocPosition> &locs);
+}
+#endif // !_IOU_LOCATE_H_FILE_
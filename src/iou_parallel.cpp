@@ -0,0 +1,52 @@
+/***********************************
+ * iou_parallel.cpp
+ *
+ * Thread helpers shared by the batch APIs.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "iou_parallel.h"
+
+namespace IOU
+{
+
+static std::atomic<int> _num_threads(0);
+
+void setNumThreads(int n)
+{
+    _num_threads = n > 0 ? n : 0;
+}
+int numThreads()
+{
+    // Asked once, hardware_concurrency() reads the system each time.
+    static const int nHardware = std::max(1, (int)std::thread::hardware_concurrency());
+    const int n = _num_threads;
+    return n > 0 ? n : nHardware;
+}
+
+namespace detail
+{
+
+// Parallel blocks running on this thread.
+static thread_local int _parallel_depth = 0;
+
+ParallelScope::ParallelScope(const bool bInside)
+    : savedDepth(_parallel_depth)
+{
+    _parallel_depth = bInside ? savedDepth + 1 : 0;
+}
+ParallelScope::~ParallelScope()
+{
+    _parallel_depth = savedDepth;
+}
+bool ParallelScope::inside()
+{
+    return _parallel_depth > 0;
+}
+
+}
+
+}
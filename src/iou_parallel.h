@@ -0,0 +1,83 @@
+/***********************************
+ * iou_parallel.h
+ *
+ * Thread helpers shared by the batch APIs.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#ifndef _IOU_PARALLEL_H_FILE_
+#define _IOU_PARALLEL_H_FILE_
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace IOU
+{
+    // Number of threads used by the batch APIs.
+    // n <= 0 means std::thread::hardware_concurrency().
+    void setNumThreads(int n);
+    int numThreads();
+
+    namespace detail
+    {
+        // Marks this thread as inside a parallel block, or outside of any,
+        // until the end of the scope. parallelFor() runs inline inside one,
+        // so nested calls do not start more threads.
+        class ParallelScope {
+        public:
+            // bInside false lets the calls in the scope start threads again,
+            // even on a thread of a parallel block.
+            explicit ParallelScope(const bool bInside = true);
+            ~ParallelScope();
+            // Whether this thread is inside a parallel block.
+            static bool inside();
+        private:
+            int savedDepth;
+            ParallelScope(const ParallelScope &);
+            ParallelScope &operator=(const ParallelScope &);
+        };
+    }
+
+    // Run func(begin, end) over [0, n) split into blocks of at most
+    // `grain` items. Blocks are handed out dynamically, so uneven work
+    // is balanced. grain <= 0 picks a block size from n and the thread count.
+    template <typename Func>
+    void parallelFor(int n, Func func, int grain = 0)
+    {
+        if (n <= 0)
+            return;
+        const int T = numThreads();
+        if (grain <= 0)
+            grain = std::max(1, n / (T * 8));
+        const int nBlocks = (n + grain - 1) / grain;
+        const int nWorkers = std::min(T, nBlocks);
+        if (nWorkers <= 1 || detail::ParallelScope::inside()) {
+            func(0, n);
+            return;
+        }
+
+        std::atomic<int> next(0);
+        auto worker = [&]() {
+            detail::ParallelScope scope;
+            for (;;) {
+                const int b = next.fetch_add(grain);
+                if (b >= n)
+                    break;
+                func(b, std::min(n, b + grain));
+            }
+        };
+        std::vector<std::thread> threads;
+        threads.reserve(nWorkers - 1);
+        for (int i = 1; i < nWorkers; ++i)
+            threads.push_back(std::thread(worker));
+        worker();
+        for (int i = 0; i < (int)threads.size(); ++i)
+            threads[i].join();
+    }
+}
+#endif // !_IOU_PARALLEL_H_FILE_
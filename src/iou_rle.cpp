@@ -0,0 +1,310 @@
+/***********************************
+ * iou_rle.cpp
+ *
+ * IoU between convex polygons and run-length-encoded (RLE) masks.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "iou_rle.h"
+#include "iou_parallel.h"
+#include <algorithm>
+
+namespace IOU
+{
+
+typedef long long PixPos;
+
+// Sorted, disjoint ranges [b, e) of flat pixel positions.
+struct PixRanges {
+    std::vector<PixPos> b;
+    std::vector<PixPos> e;
+    PixPos area;
+
+    PixRanges() : area(0) {}
+    void push(PixPos _b, PixPos _e) {
+        b.push_back(_b);
+        e.push_back(_e);
+        area += _e - _b;
+    }
+};
+
+static bool sameGeometry(const RLE &R1, const RLE &R2)
+{
+    return R1.h == R2.h && R1.w == R2.w && R1.order == R2.order;
+}
+
+static void rangesOfRle(const RLE &R, PixRanges &ranges)
+{
+    PixRanges _ranges;
+    PixPos pos = 0;
+    for (int k = 0; k < (int)R.counts.size(); ++k) {
+        const PixPos c = R.counts[k];
+        if ((k & 1) && c > 0)
+            _ranges.push(pos, pos + c);
+        pos += c;
+    }
+    std::swap(ranges, _ranges);
+}
+
+// Walk the edges of a convex polygon scanline by scanline and collect
+// the covered pixel span of each scanline.
+// A scanline is a row for RowMajor and a column for ColMajor.
+static bool rangesOfPolygon(const Vertexes &C, int h, int w, RleOrder order, PixRanges &ranges)
+{
+    PixRanges _ranges;
+    if (whichWiseEx(C) == NoneWise)
+        return false;
+
+    const bool bSwap = (order == ColMajor);
+    const int M = bSwap ? w : h; // Number of scanlines.
+    const int L = bSwap ? h : w; // Pixels per scanline.
+    const int N = C.size();
+
+    Vertexes V(C);
+    if (bSwap) {
+        for (int i = 0; i < N; ++i)
+            std::swap(V[i].x, V[i].y);
+    }
+
+    double yMin = V[0].y, yMax = V[0].y;
+    for (int i = 1; i < N; ++i) {
+        yMin = std::min(yMin, V[i].y);
+        yMax = std::max(yMax, V[i].y);
+    }
+    const int r0 = std::max(0, (int)ceil(yMin - EPS));
+    const int r1 = std::min(M - 1, (int)floor(yMax + EPS));
+    if (r0 > r1) {
+        std::swap(ranges, _ranges);
+        return true;
+    }
+
+    std::vector<double> lo(r1 - r0 + 1, 1e300);
+    std::vector<double> hi(r1 - r0 + 1, -1e300);
+    for (int i = 0; i < N; ++i) {
+        const Point &a = V[i];
+        const Point &b = V[(i + 1) % N];
+        const int e0 = std::max(r0, (int)ceil(std::min(a.y, b.y) - EPS));
+        const int e1 = std::min(r1, (int)floor(std::max(a.y, b.y) + EPS));
+        const double dy = b.y - a.y;
+        for (int r = e0; r <= e1; ++r) {
+            double x0, x1;
+            if (abs(dy) <= EPS) {
+                x0 = std::min(a.x, b.x);
+                x1 = std::max(a.x, b.x);
+            }
+            else {
+                double t = (r - a.y) / dy;
+                t = std::max(0.0, std::min(1.0, t));
+                x0 = x1 = a.x + t * (b.x - a.x);
+            }
+            lo[r - r0] = std::min(lo[r - r0], x0);
+            hi[r - r0] = std::max(hi[r - r0], x1);
+        }
+    }
+
+    for (int r = r0; r <= r1; ++r) {
+        if (lo[r - r0] > hi[r - r0])
+            continue;
+        const int c0 = std::max(0, (int)ceil(lo[r - r0] - EPS));
+        const int c1 = std::min(L - 1, (int)floor(hi[r - r0] + EPS));
+        if (c0 <= c1)
+            _ranges.push((PixPos)r * L + c0, (PixPos)r * L + c1 + 1);
+    }
+    std::swap(ranges, _ranges);
+    return true;
+}
+
+static PixPos overlapOfRanges(const PixRanges &A, const PixRanges &B)
+{
+    if (A.b.empty() || B.b.empty())
+        return 0;
+    if (A.b.front() >= B.e.back() || B.b.front() >= A.e.back())
+        return 0;
+
+    // Skip the runs that end before the other list starts.
+    int i = std::upper_bound(A.e.begin(), A.e.end(), B.b.front()) - A.e.begin();
+    int j = std::upper_bound(B.e.begin(), B.e.end(), A.b.front()) - B.e.begin();
+    const int NA = A.b.size();
+    const int NB = B.b.size();
+    PixPos s = 0;
+    while (i < NA && j < NB) {
+        const PixPos lo = std::max(A.b[i], B.b[j]);
+        const PixPos hi = std::min(A.e[i], B.e[j]);
+        if (hi > lo)
+            s += hi - lo;
+        if (A.e[i] < B.e[j])
+            ++i;
+        else
+            ++j;
+    }
+    return s;
+}
+
+static double iouOfCounts(PixPos nA, PixPos nB, PixPos nI)
+{
+    const PixPos nU = nA + nB - nI;
+    return nU > 0 ? (nI * 1.0) / (nU * 1.0) : 0.0;
+}
+
+double areaRle(const RLE &R)
+{
+    PixPos s = 0;
+    for (int k = 1; k < (int)R.counts.size(); k += 2)
+        s += R.counts[k];
+    return s;
+}
+bool rleFromPolygon(const Vertexes &C, int h, int w, RLE &R, RleOrder order)
+{
+    RLE _R;
+    PixRanges ranges;
+    if (!rangesOfPolygon(C, h, w, order, ranges)) {
+        std::swap(R, _R);
+        return false;
+    }
+    _R.h = h;
+    _R.w = w;
+    _R.order = order;
+
+    PixPos prev = 0;
+    for (int i = 0; i < (int)ranges.b.size(); ++i) {
+        _R.counts.push_back(ranges.b[i] - prev);
+        _R.counts.push_back(ranges.e[i] - ranges.b[i]);
+        prev = ranges.e[i];
+    }
+    const PixPos total = (PixPos)h * w;
+    if (total > prev)
+        _R.counts.push_back(total - prev);
+    std::swap(R, _R);
+    return true;
+}
+
+double areaIntersectionRle(const Vertexes &C, const RLE &R)
+{
+    PixRanges P, Q;
+    if (!rangesOfPolygon(C, R.h, R.w, R.order, P))
+        return -1.0;
+    rangesOfRle(R, Q);
+    return overlapOfRanges(P, Q);
+}
+double areaUnionRle(const Vertexes &C, const RLE &R)
+{
+    PixRanges P, Q;
+    if (!rangesOfPolygon(C, R.h, R.w, R.order, P))
+        return -1.0;
+    rangesOfRle(R, Q);
+    return P.area + Q.area - overlapOfRanges(P, Q);
+}
+double iouRle(const Vertexes &C, const RLE &R)
+{
+    PixRanges P, Q;
+    if (!rangesOfPolygon(C, R.h, R.w, R.order, P))
+        return -1.0;
+    rangesOfRle(R, Q);
+    return iouOfCounts(P.area, Q.area, overlapOfRanges(P, Q));
+}
+
+double areaIntersectionRle(const RLE &R1, const RLE &R2)
+{
+    if (!sameGeometry(R1, R2))
+        return -1.0;
+    PixRanges P, Q;
+    rangesOfRle(R1, P);
+    rangesOfRle(R2, Q);
+    return overlapOfRanges(P, Q);
+}
+double areaUnionRle(const RLE &R1, const RLE &R2)
+{
+    if (!sameGeometry(R1, R2))
+        return -1.0;
+    PixRanges P, Q;
+    rangesOfRle(R1, P);
+    rangesOfRle(R2, Q);
+    return P.area + Q.area - overlapOfRanges(P, Q);
+}
+double iouRle(const RLE &R1, const RLE &R2)
+{
+    if (!sameGeometry(R1, R2))
+        return -1.0;
+    PixRanges P, Q;
+    rangesOfRle(R1, P);
+    rangesOfRle(R2, Q);
+    return iouOfCounts(P.area, Q.area, overlapOfRanges(P, Q));
+}
+
+void iouRleBatch(const std::vector<Vertexes> &Cs, const std::vector<RLE> &Rs, std::vector<double> &ious)
+{
+    const int N = Cs.size();
+    const int M = Rs.size();
+    std::vector<double> _ious((size_t)N * M, 0.0);
+    if (N == 0 || M == 0) {
+        ious.swap(_ious);
+        return;
+    }
+
+    std::vector<PixRanges> runs(M);
+    parallelFor(M, [&](int b, int e) {
+        for (int j = b; j < e; ++j)
+            rangesOfRle(Rs[j], runs[j]);
+    });
+
+    // Polygons are scanned once against the geometry of the first mask,
+    // and again only for masks of another size or order.
+    const RLE &R0 = Rs[0];
+    parallelFor(N, [&](int b, int e) {
+        for (int i = b; i < e; ++i) {
+            PixRanges P;
+            const bool bValid = rangesOfPolygon(Cs[i], R0.h, R0.w, R0.order, P);
+            double *row = &_ious[(size_t)i * M];
+            for (int j = 0; j < M; ++j) {
+                if (!bValid) {
+                    row[j] = -1.0;
+                    continue;
+                }
+                if (sameGeometry(Rs[j], R0)) {
+                    row[j] = iouOfCounts(P.area, runs[j].area, overlapOfRanges(P, runs[j]));
+                }
+                else {
+                    PixRanges Pj;
+                    rangesOfPolygon(Cs[i], Rs[j].h, Rs[j].w, Rs[j].order, Pj);
+                    row[j] = iouOfCounts(Pj.area, runs[j].area, overlapOfRanges(Pj, runs[j]));
+                }
+            }
+        }
+    });
+    ious.swap(_ious);
+}
+void iouRleBatch(const std::vector<RLE> &R1s, const std::vector<RLE> &R2s, std::vector<double> &ious)
+{
+    const int N = R1s.size();
+    const int M = R2s.size();
+    std::vector<double> _ious((size_t)N * M, 0.0);
+
+    std::vector<PixRanges> runs1(N), runs2(M);
+    parallelFor(N, [&](int b, int e) {
+        for (int i = b; i < e; ++i)
+            rangesOfRle(R1s[i], runs1[i]);
+    });
+    parallelFor(M, [&](int b, int e) {
+        for (int j = b; j < e; ++j)
+            rangesOfRle(R2s[j], runs2[j]);
+    });
+
+    parallelFor(N, [&](int b, int e) {
+        for (int i = b; i < e; ++i) {
+            double *row = &_ious[(size_t)i * M];
+            for (int j = 0; j < M; ++j) {
+                if (!sameGeometry(R1s[i], R2s[j]))
+                    row[j] = -1.0;
+                else
+                    row[j] = iouOfCounts(runs1[i].area, runs2[j].area,
+                                         overlapOfRanges(runs1[i], runs2[j]));
+            }
+        }
+    });
+    ious.swap(_ious);
+}
+
+}
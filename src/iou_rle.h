@@ -0,0 +1,69 @@
+/***********************************
+ * iou_rle.h
+ *
+ * IoU between convex polygons and run-length-encoded (RLE) masks.
+ * Polygons are walked scanline by scanline against the runs, so the
+ * cost scales with the polygon height and the run count instead of the
+ * image area.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#ifndef _IOU_RLE_H_FILE_
+#define _IOU_RLE_H_FILE_
+
+#include "iou.h"
+
+namespace IOU
+{
+    enum RleOrder
+    {
+        RowMajor,   // Runs follow image rows (scanlines).
+        ColMajor    // Runs follow image columns (COCO layout).
+    };
+
+    // Binary mask of h x w pixels.
+    // counts[] alternate between runs of 0s and runs of 1s,
+    // always starting with 0s (the first count may be 0).
+    struct RLE {
+        // Members
+        int h;
+        int w;
+        RleOrder order;
+        std::vector<unsigned int> counts;
+
+        // Constructors
+        RLE() : h(0), w(0), order(RowMajor) {}
+        RLE(int _h, int _w, const std::vector<unsigned int> &_counts, RleOrder _order = RowMajor)
+            : h(_h), w(_w), order(_order), counts(_counts) {}
+    };
+
+    // Pixel (col j, row i) is centered at Point(j, i), the same
+    // convention as drawing the polygon with its vertexes as pixel
+    // coordinates. Pixels whose centers lie inside or on the edge of
+    // the polygon are counted.
+
+    // Area is in pixels.
+    double areaRle(const RLE &R);
+    // Return false for a non-convex polygon, and R is made an empty
+    // 0 x 0 mask, which gives -1.0 against masks of any other size.
+    bool rleFromPolygon(const Vertexes &C, int h, int w, RLE &R, RleOrder order = RowMajor);
+
+    // Polygon vs. RLE. Return -1.0 for a non-convex polygon.
+    double areaIntersectionRle(const Vertexes &C, const RLE &R);
+    double areaUnionRle(const Vertexes &C, const RLE &R);
+    double iouRle(const Vertexes &C, const RLE &R);
+
+    // RLE vs. RLE. Return -1.0 if the masks differ in size or order.
+    double areaIntersectionRle(const RLE &R1, const RLE &R2);
+    double areaUnionRle(const RLE &R1, const RLE &R2);
+    double iouRle(const RLE &R1, const RLE &R2);
+
+    // Many vs. many, in parallel.
+    // ious is resized to Cs.size() x Rs.size(), in row-major order.
+    void iouRleBatch(const std::vector<Vertexes> &Cs, const std::vector<RLE> &Rs, std::vector<double> &ious);
+    void iouRleBatch(const std::vector<RLE> &R1s, const std::vector<RLE> &R2s, std::vector<double> &ious);
+}
+#endif // !_IOU_RLE_H_FILE_
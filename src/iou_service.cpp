@@ -0,0 +1,184 @@
+/***********************************
+ * iou_service.cpp
+ *
+ * Asynchronous iou requests, coalesced into larger batches.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "iou_service.h"
+#include "iou_engine.h"
+#include "iou_parallel.h"
+
+namespace IOU
+{
+
+IouService::IouService(const int _nWorkers, const int _maxBatchPairs, const double _maxDelayMs)
+    : maxBatchPairs(std::max(1, _maxBatchPairs)),
+      maxDelay(std::chrono::duration_cast<Clock::duration>(
+          std::chrono::duration<double, std::milli>(std::max(0.0, _maxDelayMs)))),
+      bStop(false), queuedPairs(0)
+{
+    // Calibrate now rather than in the first batch.
+    dispatchPlan();
+    const int nWorkers = _nWorkers > 0 ? _nWorkers : numThreads();
+    // With several workers each batch runs on one thread, one worker
+    // spreads its batches over numThreads() instead.
+    const bool bSerial = nWorkers > 1;
+    for (int i = 0; i < nWorkers; ++i)
+        workers.push_back(std::thread(&IouService::workerLoop, this, bSerial));
+}
+IouService::~IouService()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        bStop = true;
+    }
+    cond.notify_all();
+    for (int i = 0; i < (int)workers.size(); ++i)
+        workers[i].join();
+}
+
+std::future<IouResult> IouService::submit(const std::vector<Vertexes> &C1s, const std::vector<Vertexes> &C2s)
+{
+    Request *request = new Request;
+    request->C1s = C1s;
+    request->C2s = C2s;
+    std::future<IouResult> future = request->promise.get_future();
+    enqueue(request);
+    return future;
+}
+void IouService::submit(const std::vector<Vertexes> &C1s, const std::vector<Vertexes> &C2s,
+                        const IouCallback &callback)
+{
+    Request *request = new Request;
+    request->C1s = C1s;
+    request->C2s = C2s;
+    request->callback = callback;
+    enqueue(request);
+}
+int IouService::queuedCount()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return queue.size();
+}
+
+void IouService::enqueue(Request *request)
+{
+    request->nPairs = (long long)request->C1s.size() * request->C2s.size();
+    request->tSubmit = Clock::now();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(request);
+        queuedPairs += request->nPairs;
+    }
+    cond.notify_all();
+}
+
+void IouService::workerLoop(const bool bSerial)
+{
+    detail::ParallelScope scope(bSerial);
+
+    std::vector<Request *> batch;
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        cond.wait(lock, [this]() { return bStop || !queue.empty(); });
+        if (queue.empty())
+            break;
+
+        // Give other requests a chance to join, until the batch is full
+        // or the oldest request is due.
+        const Clock::time_point due = queue.front()->tSubmit + maxDelay;
+        while (!bStop && !queue.empty() && queuedPairs < maxBatchPairs && Clock::now() < due)
+            cond.wait_until(lock, due);
+        if (queue.empty())
+            continue;  // Taken by another worker.
+
+        // Oldest first, at least one request however large.
+        long long nPairs = 0;
+        batch.clear();
+        while (!queue.empty() &&
+               (batch.empty() || nPairs + queue.front()->nPairs <= maxBatchPairs)) {
+            nPairs += queue.front()->nPairs;
+            batch.push_back(queue.front());
+            queue.pop_front();
+        }
+        queuedPairs -= nPairs;
+
+        lock.unlock();
+        runBatch(batch, Clock::now());
+        lock.lock();
+    }
+}
+
+void IouService::runBatch(std::vector<Request *> &batch, const Clock::time_point tStart)
+{
+    // All requests as one list of pairs over all their polygons.
+    // A failure is handed to every request of the batch, so no future
+    // is left waiting and the worker goes on.
+    long long nPairs = 0;
+    for (int r = 0; r < (int)batch.size(); ++r)
+        nPairs += batch[r]->nPairs;
+    std::vector<double> ious;
+    std::exception_ptr error;
+    try {
+        std::vector<const Vertexes *> C1s, C2s;
+        std::vector<std::pair<int, int> > pairs;
+        for (int r = 0; r < (int)batch.size(); ++r) {
+            const Request &request = *batch[r];
+            const int i0 = C1s.size();
+            const int j0 = C2s.size();
+            const int N = request.C1s.size();
+            const int M = request.C2s.size();
+            for (int i = 0; i < N; ++i)
+                C1s.push_back(&request.C1s[i]);
+            for (int j = 0; j < M; ++j)
+                C2s.push_back(&request.C2s[j]);
+            for (int i = 0; i < N; ++i)
+                for (int j = 0; j < M; ++j)
+                    pairs.push_back(std::make_pair(i0 + i, j0 + j));
+        }
+        iouAutoPairs(C1s, C2s, pairs, ious);
+    }
+    catch (...) {
+        error = std::current_exception();
+        ious.clear();
+    }
+    const Clock::time_point tEnd = Clock::now();
+
+    typedef std::chrono::duration<double, std::milli> Ms;
+    const double execMs = Ms(tEnd - tStart).count();
+    size_t k = 0;
+    for (int r = 0; r < (int)batch.size(); ++r) {
+        Request *request = batch[r];
+        IouResult result;
+        if (!error) {
+            result.ious.assign(ious.begin() + k, ious.begin() + k + request->nPairs);
+            k += request->nPairs;
+        }
+        result.queueMs = Ms(tStart - request->tSubmit).count();
+        result.execMs = execMs;
+        result.batchRequests = batch.size();
+        result.batchPairs = nPairs;
+        result.error = error;
+
+        if (request->callback) {
+            try {
+                request->callback(result);
+            }
+            catch (...) {
+            }
+        }
+        else if (error) {
+            request->promise.set_exception(error);
+        }
+        else {
+            request->promise.set_value(std::move(result));
+        }
+        delete request;
+    }
+}
+
+}
@@ -0,0 +1,89 @@
+/***********************************
+ * iou_service.h
+ *
+ * Asynchronous iou requests, coalesced into larger batches.
+ *
+ * Requests from many threads wait in one queue. A pool of workers takes
+ * them in batches of up to maxBatchPairs pairs, or fewer once the oldest
+ * request has waited maxDelayMs, and runs each batch through
+ * iouAutoPairs() of iou_engine.h.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#ifndef _IOU_SERVICE_H_FILE_
+#define _IOU_SERVICE_H_FILE_
+
+#include "iou.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+
+namespace IOU
+{
+    struct IouResult {
+        // C1s.size() x C2s.size() iou ratios, in row-major order, -1.0 for non-convex polygons.
+        std::vector<double> ious;
+        double queueMs;     // From submit() to the start of its batch.
+        double execMs;      // Run time of its whole batch, the same for every request in it.
+        int batchRequests;  // Requests in its batch.
+        int batchPairs;     // Pairs in its batch.
+        // Set if its batch failed, ious is then empty. The future of
+        // submit() throws it instead.
+        std::exception_ptr error;
+    };
+    typedef std::function<void(IouResult &result)> IouCallback;
+
+    class IouService {
+    public:
+        // Constructors
+        // nWorkers <= 0 means numThreads() workers.
+        IouService(const int _nWorkers = 0, const int _maxBatchPairs = 1 << 16,
+                   const double _maxDelayMs = 1.0);
+        // Runs the requests still queued, then stops the workers.
+        ~IouService();
+
+        // Methods
+        // Iou of all pairs of C1s x C2s. The polygons are copied.
+        std::future<IouResult> submit(const std::vector<Vertexes> &C1s, const std::vector<Vertexes> &C2s);
+        // The callback runs on a worker thread and should return quickly.
+        // What it throws is dropped.
+        void submit(const std::vector<Vertexes> &C1s, const std::vector<Vertexes> &C2s,
+                    const IouCallback &callback);
+        // Requests submitted but not started yet.
+        int queuedCount();
+
+    private:
+        typedef std::chrono::steady_clock Clock;
+        struct Request {
+            std::vector<Vertexes> C1s;
+            std::vector<Vertexes> C2s;
+            std::promise<IouResult> promise;
+            IouCallback callback;
+            Clock::time_point tSubmit;
+            long long nPairs;
+        };
+
+        int maxBatchPairs;
+        Clock::duration maxDelay;
+        bool bStop;
+        long long queuedPairs;
+        std::deque<Request *> queue;
+        std::mutex mutex;
+        std::condition_variable cond;
+        std::vector<std::thread> workers;
+
+        IouService(const IouService &);
+        IouService &operator=(const IouService &);
+        void enqueue(Request *request);
+        void workerLoop(const bool bSerial);
+        void runBatch(std::vector<Request *> &batch, const Clock::time_point tStart);
+    };
+}
+#endif // !_IOU_SERVICE_H_FILE_
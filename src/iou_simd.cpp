@@ -0,0 +1,162 @@
+/***********************************
+ * iou_simd.cpp
+ *
+ * Intersection and iou of many quad pairs at once,
+ * one pair per SIMD lane.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "iou_simd.h"
+#include "iou_parallel.h"
+#include <algorithm>
+#include <string.h>
+#include "iou_simd_kernel.h"
+
+namespace IOU
+{
+
+static void quadRangeScalar(const float *const ax[8], const float *const bx[8],
+                            int b, int e, float *out, const bool bIou)
+{
+    quadRange<float>(ax, bx, b, e, out, bIou);
+}
+
+#ifdef IOU_SIMD_X86
+static void quadRangeSse2(const float *const ax[8], const float *const bx[8],
+                          int b, int e, float *out, const bool bIou)
+{
+    quadRange<vf4>(ax, bx, b, e, out, bIou);
+}
+#endif
+
+//---------------
+// Dispatch.
+static SimdIsa detectSimdIsa()
+{
+#ifdef IOU_SIMD_X86
+    __builtin_cpu_init();
+    // The AVX-512 file is built with DQ as well, which some AVX512F CPUs lack.
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq"))
+        return IsaAvx512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return IsaAvx2;
+    if (__builtin_cpu_supports("sse2"))
+        return IsaSse2;
+#endif
+    return IsaScalar;
+}
+
+static std::atomic<int> _simd_isa(-1);
+
+SimdIsa bestSimdIsa()
+{
+    static const SimdIsa best = detectSimdIsa();
+    return best;
+}
+SimdIsa simdIsa()
+{
+    const int isa = _simd_isa;
+    return isa < 0 ? bestSimdIsa() : (SimdIsa)isa;
+}
+void setSimdIsa(const SimdIsa isa)
+{
+    _simd_isa = std::min(isa, bestSimdIsa());
+}
+const char *simdIsaName(const SimdIsa isa)
+{
+    switch (isa) {
+    case IsaSse2:
+        return "SSE2";
+    case IsaAvx2:
+        return "AVX2";
+    case IsaAvx512:
+        return "AVX-512";
+    default:
+        return "Scalar";
+    }
+}
+
+static QuadRangeFunc quadRangeFunc(const SimdIsa isa)
+{
+#ifdef IOU_SIMD_X86
+    switch (isa) {
+    case IsaAvx512:
+        return quadRangeAvx512;
+    case IsaAvx2:
+        return quadRangeAvx2;
+    case IsaSse2:
+        return quadRangeSse2;
+    default:
+        break;
+    }
+#endif
+    return quadRangeScalar;
+}
+
+//---------------
+void QuadBatch::clear()
+{
+    for (int k = 0; k < 4; ++k) {
+        x[k].clear();
+        y[k].clear();
+    }
+}
+void QuadBatch::reserve(int n)
+{
+    for (int k = 0; k < 4; ++k) {
+        x[k].reserve(n);
+        y[k].reserve(n);
+    }
+}
+void QuadBatch::push_back(const Quad &Q)
+{
+    const Point *p[4] = {&Q.p1, &Q.p2, &Q.p3, &Q.p4};
+    for (int k = 0; k < 4; ++k) {
+        x[k].push_back((float)p[k]->x);
+        y[k].push_back((float)p[k]->y);
+    }
+}
+void QuadBatch::push_back(const Vertexes &C)
+{
+    assert(C.size() == 4);
+    for (int k = 0; k < 4; ++k) {
+        x[k].push_back((float)C[k].x);
+        y[k].push_back((float)C[k].y);
+    }
+}
+
+static void quadBatch(const QuadBatch &Q1s, const QuadBatch &Q2s, std::vector<float> &out, const bool bIou)
+{
+    assert(Q1s.size() == Q2s.size());
+    const int N = Q1s.size();
+    std::vector<float> _out(N);
+    if (N > 0) {
+        const float *ax[8], *bx[8];
+        for (int k = 0; k < 4; ++k) {
+            ax[k] = Q1s.x[k].data();
+            ax[4 + k] = Q1s.y[k].data();
+            bx[k] = Q2s.x[k].data();
+            bx[4 + k] = Q2s.y[k].data();
+        }
+        const QuadRangeFunc func = quadRangeFunc(simdIsa());
+        float *pOut = _out.data();
+        parallelFor(N, [&](int b, int e) {
+            func(ax, bx, b, e, pOut, bIou);
+        }, 4096);
+    }
+    out.swap(_out);
+}
+
+void areaIntersectionBatch(const QuadBatch &Q1s, const QuadBatch &Q2s, std::vector<float> &areas)
+{
+    quadBatch(Q1s, Q2s, areas, false);
+}
+void iouBatch(const QuadBatch &Q1s, const QuadBatch &Q2s, std::vector<float> &ious)
+{
+    quadBatch(Q1s, Q2s, ious, true);
+}
+
+}
@@ -0,0 +1,63 @@
+/***********************************
+ * iou_simd.h
+ *
+ * Intersection and iou of many quad pairs at once,
+ * one pair per SIMD lane.
+ *
+ * Every edge of one quad is clipped against the four half-planes of
+ * the other with min/max and masks only, and the area is summed from
+ * the clipped edges (Green's theorem). There is no branch on the data,
+ * so 4, 8 or 16 pairs run together depending on the instruction set
+ * found at runtime.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#ifndef _IOU_SIMD_H_FILE_
+#define _IOU_SIMD_H_FILE_
+
+#include "iou.h"
+
+namespace IOU
+{
+    enum SimdIsa
+    {
+        IsaScalar,  // One pair at a time.
+        IsaSse2,    // 4 lanes.
+        IsaAvx2,    // 8 lanes.
+        IsaAvx512   // 16 lanes.
+    };
+
+    // Best instruction set supported by this CPU and build.
+    SimdIsa bestSimdIsa();
+    // Instruction set used by the batch functions, bestSimdIsa() by default.
+    // Asking for more than bestSimdIsa() gives bestSimdIsa().
+    SimdIsa simdIsa();
+    void setSimdIsa(const SimdIsa isa);
+    const char *simdIsaName(const SimdIsa isa);
+
+    // Quads in structure-of-arrays layout, in single precision.
+    // Vertex k of quad i is (x[k][i], y[k][i]). Either wise is accepted.
+    class QuadBatch {
+    public:
+        // Members
+        std::vector<float> x[4];
+        std::vector<float> y[4];
+
+        // Methods
+        int size() const { return x[0].size(); }
+        void clear();
+        void reserve(int n);
+        void push_back(const Quad &Q);
+        void push_back(const Vertexes &C);  // C must have 4 vertexes.
+    };
+
+    // Results for pairs (Q1s[i], Q2s[i]), resized to Q1s.size().
+    // Non-convex quads give -1.0, as areaIntersection() and iou() do.
+    // Results match the scalar functions up to single precision.
+    void areaIntersectionBatch(const QuadBatch &Q1s, const QuadBatch &Q2s, std::vector<float> &areas);
+    void iouBatch(const QuadBatch &Q1s, const QuadBatch &Q2s, std::vector<float> &ious);
+}
+#endif // !_IOU_SIMD_H_FILE_
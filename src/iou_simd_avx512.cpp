@@ -0,0 +1,29 @@
+/***********************************
+ * iou_simd_avx512.cpp
+ *
+ * The lane kernel built for AVX-512, 16 lanes.
+ * Only called when the CPU supports it.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "iou.h"
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#pragma GCC target("avx512f,avx512dq")
+#include "iou_simd_kernel.h"
+
+namespace IOU
+{
+
+void quadRangeAvx512(const float *const ax[8], const float *const bx[8],
+                      int b, int e, float *out, const bool bIou)
+{
+    quadRange<vf16>(ax, bx, b, e, out, bIou);
+}
+
+}
+#endif
@@ -0,0 +1,245 @@
+/***********************************
+ * iou_simd_kernel.h
+ *
+ * The lane kernel of iou_simd.cpp, written once for any lane type.
+ *
+ * Each instruction set compiles it in its own file, after
+ * "#pragma GCC target", so the vector types get the right masks
+ * and are not split into scalars. Include it after every other header,
+ * which must not take the target. Everything here is static,
+ * so no copy is shared between files built for different targets.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#ifndef _IOU_SIMD_KERNEL_H_FILE_
+#define _IOU_SIMD_KERNEL_H_FILE_
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define IOU_SIMD_X86
+#endif
+#if defined(__GNUC__)
+// Kept to this header, where the vector types are passed by value.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+#if defined(__GNUC__)
+#define IOU_SIMD_INLINE static inline __attribute__((always_inline))
+#else
+#define IOU_SIMD_INLINE static inline
+#endif
+
+namespace IOU
+{
+
+//---------------
+// Lane types.
+// The kernel is written once for a float-like type V with mask type
+// MaskOf<V>::type: plain float/bool for the scalar path, and GCC vector
+// extensions for the SIMD paths.
+template <typename V> struct MaskOf { typedef bool type; };
+
+IOU_SIMD_INLINE bool maskAnd(bool a, bool b) { return a && b; }
+IOU_SIMD_INLINE bool maskOr(bool a, bool b) { return a || b; }
+IOU_SIMD_INLINE bool maskNot(bool a) { return !a; }
+IOU_SIMD_INLINE float select(bool m, float a, float b) { return m ? a : b; }
+
+#ifdef IOU_SIMD_X86
+typedef float vf4 __attribute__((vector_size(16)));
+typedef int vi4 __attribute__((vector_size(16)));
+typedef float vf8 __attribute__((vector_size(32)));
+typedef int vi8 __attribute__((vector_size(32)));
+typedef float vf16 __attribute__((vector_size(64)));
+typedef int vi16 __attribute__((vector_size(64)));
+
+template <> struct MaskOf<vf4> { typedef vi4 type; };
+template <> struct MaskOf<vf8> { typedef vi8 type; };
+template <> struct MaskOf<vf16> { typedef vi16 type; };
+
+template <typename M> IOU_SIMD_INLINE M maskAnd(M a, M b) { return a & b; }
+template <typename M> IOU_SIMD_INLINE M maskOr(M a, M b) { return a | b; }
+template <typename M> IOU_SIMD_INLINE M maskNot(M a) { return ~a; }
+template <typename M, typename V> IOU_SIMD_INLINE V select(M m, V a, V b) { return m ? a : b; }
+#endif
+
+template <typename V> IOU_SIMD_INLINE V splat(float f) { return V{} + f; }
+template <typename V> IOU_SIMD_INLINE V vload(const float *p) { V v; memcpy(&v, p, sizeof(V)); return v; }
+template <typename V> IOU_SIMD_INLINE void vstore(float *p, V v) { memcpy(p, &v, sizeof(V)); }
+template <typename V> IOU_SIMD_INLINE V vmin(V a, V b) { return select(a < b, a, b); }
+template <typename V> IOU_SIMD_INLINE V vmax(V a, V b) { return select(a > b, a, b); }
+
+// Squared relative tolerance of the parallel and on-line tests.
+static const float SIMD_TOL2 = 1e-10f;
+// Relative tolerance of the convexity test. Collinear vertexes rounded
+// to single precision turn a little either way, and must stay convex.
+static const float SIMD_CONVEX_TOL = 1e-4f;
+
+template <typename V>
+struct QuadLanes {
+    V x[4];
+    V y[4];
+};
+
+// Shift by (ox, oy), put in anticlockwise, and give the area and validity.
+template <typename V>
+IOU_SIMD_INLINE void prepareQuad(QuadLanes<V> &q, V ox, V oy,
+                                   V &area, typename MaskOf<V>::type &valid)
+{
+    typedef typename MaskOf<V>::type M;
+    for (int k = 0; k < 4; ++k) {
+        q.x[k] -= ox;
+        q.y[k] -= oy;
+    }
+    V s2 = splat<V>(0.0f);
+    V cMin = splat<V>(0.0f), cMax = splat<V>(0.0f);
+    for (int k = 0; k < 4; ++k) {
+        const int k1 = (k + 1) & 3;
+        const int k2 = (k + 2) & 3;
+        s2 += q.x[k] * q.y[k1] - q.x[k1] * q.y[k];
+        const V c = (q.x[k1] - q.x[k]) * (q.y[k2] - q.y[k1]) -
+                    (q.y[k1] - q.y[k]) * (q.x[k2] - q.x[k1]);
+        cMin = k == 0 ? c : vmin(cMin, c);
+        cMax = k == 0 ? c : vmax(cMax, c);
+    }
+    // Convex: every turn on the same side, collinear vertexes allowed.
+    const V tol = vmax(s2, -s2) * splat<V>(SIMD_CONVEX_TOL);
+    const M ccw = maskAnd(s2 > tol, cMin >= -tol);
+    const M cw = maskAnd(s2 < -tol, cMax <= tol);
+    valid = maskOr(ccw, cw);
+
+    // Swap vertexes 1 and 3 of the clockwise ones.
+    const V x1 = q.x[1], y1 = q.y[1];
+    q.x[1] = select(cw, q.x[3], x1);
+    q.y[1] = select(cw, q.y[3], y1);
+    q.x[3] = select(cw, x1, q.x[3]);
+    q.y[3] = select(cw, y1, q.y[3]);
+    area = vmax(s2, -s2) * splat<V>(0.5f);
+}
+
+// Sum of the parts of P's edges inside Q, as Green's theorem terms.
+// Edges of P lying on an edge of Q in the same direction are kept only
+// if bKeepShared, so shared edges are counted once.
+template <typename V>
+IOU_SIMD_INLINE V clipEdges(const QuadLanes<V> &P, const QuadLanes<V> &Q, const bool bKeepShared)
+{
+    typedef typename MaskOf<V>::type M;
+    const V zero = splat<V>(0.0f);
+    const V one = splat<V>(1.0f);
+    const V tol2 = splat<V>(SIMD_TOL2);
+    V sum = zero;
+    for (int i = 0; i < 4; ++i) {
+        const int i1 = (i + 1) & 3;
+        const V sx = P.x[i], sy = P.y[i];
+        const V dx = P.x[i1] - sx, dy = P.y[i1] - sy;
+        const V dd = dx * dx + dy * dy;
+        V t0 = zero, t1 = one;
+        for (int k = 0; k < 4; ++k) {
+            const int k1 = (k + 1) & 3;
+            const V ex = Q.x[k1] - Q.x[k], ey = Q.y[k1] - Q.y[k];
+            // Inside of edge k at t: num + t * den >= 0.
+            const V num = ex * (sy - Q.y[k]) - ey * (sx - Q.x[k]);
+            const V den = ex * dy - ey * dx;
+            const V ee = ex * ex + ey * ey;
+            const V tol = tol2 * ee * dd;
+            // A repeated vertex of Q gives an edge of no direction, which
+            // bounds nothing.
+            const M none = ee <= tol2 * dd;
+            const M par = maskOr(den * den <= tol, none);
+            const V r = -num / select(par, one, den);
+            t0 = select(maskAnd(maskNot(par), den > zero), vmax(t0, r), t0);
+            t1 = select(maskAnd(maskNot(par), den < zero), vmin(t1, r), t1);
+
+            // Parallel edges: keep if strictly inside, or shared and allowed.
+            const M onLine = num * num <= tol;
+            const M inside = maskAnd(maskNot(onLine), num > zero);
+            M keep = maskOr(inside, none);
+            if (bKeepShared)
+                keep = maskOr(keep, maskAnd(onLine, ex * dx + ey * dy > zero));
+            t1 = select(maskAnd(par, maskNot(keep)), -one, t1);
+        }
+        const V c = (t1 - t0) * (sx * dy - sy * dx) * splat<V>(0.5f);
+        sum += select(t1 > t0, c, zero);
+    }
+    return sum;
+}
+
+// Intersection and areas of W pairs starting at i0.
+template <typename V>
+IOU_SIMD_INLINE void quadLanes(const float *const ax[8], const float *const bx[8], int i0,
+                                 V &inter, V &areaA, V &areaB,
+                                 typename MaskOf<V>::type &valid)
+{
+    typedef typename MaskOf<V>::type M;
+    QuadLanes<V> P, Q;
+    for (int k = 0; k < 4; ++k) {
+        P.x[k] = vload<V>(ax[k] + i0);
+        P.y[k] = vload<V>(ax[4 + k] + i0);
+        Q.x[k] = vload<V>(bx[k] + i0);
+        Q.y[k] = vload<V>(bx[4 + k] + i0);
+    }
+    // A local origin keeps the products small in single precision.
+    const V ox = P.x[0], oy = P.y[0];
+    M validA, validB;
+    prepareQuad(P, ox, oy, areaA, validA);
+    prepareQuad(Q, ox, oy, areaB, validB);
+    valid = maskAnd(validA, validB);
+    inter = clipEdges(P, Q, true) + clipEdges(Q, P, false);
+    inter = vmax(inter, splat<V>(0.0f));
+}
+
+// Run pairs [b, e) in blocks of W lanes; the tail goes through a padded copy.
+template <typename V>
+IOU_SIMD_INLINE void quadRange(const float *const ax[8], const float *const bx[8],
+                                 int b, int e, float *out, const bool bIou)
+{
+    const int W = sizeof(V) / sizeof(float);
+    const V minus = splat<V>(-1.0f);
+    int i = b;
+    for (; i <= e - W; i += W) {
+        V inter, areaA, areaB;
+        typename MaskOf<V>::type valid;
+        quadLanes<V>(ax, bx, i, inter, areaA, areaB, valid);
+        V r = bIou ? inter / vmax(areaA + areaB - inter, splat<V>(1e-30f)) : inter;
+        vstore<V>(out + i, select(valid, r, minus));
+    }
+    if (i < e) {
+        float pad[16][W];
+        const float *pa[8], *pb[8];
+        for (int k = 0; k < 8; ++k) {
+            for (int l = 0; l < W; ++l) {
+                pad[k][l] = i + l < e ? ax[k][i + l] : 0.0f;
+                pad[8 + k][l] = i + l < e ? bx[k][i + l] : 0.0f;
+            }
+            pa[k] = pad[k];
+            pb[k] = pad[8 + k];
+        }
+        V inter, areaA, areaB;
+        typename MaskOf<V>::type valid;
+        quadLanes<V>(pa, pb, 0, inter, areaA, areaB, valid);
+        V r = bIou ? inter / vmax(areaA + areaB - inter, splat<V>(1e-30f)) : inter;
+        float res[W];
+        vstore<V>(res, select(valid, r, minus));
+        for (int l = 0; i + l < e; ++l)
+            out[i + l] = res[l];
+    }
+}
+
+typedef void (*QuadRangeFunc)(const float *const ax[8], const float *const bx[8],
+                              int b, int e, float *out, const bool bIou);
+
+// Entries of the instruction sets built in their own files.
+#ifdef IOU_SIMD_X86
+void quadRangeAvx2(const float *const ax[8], const float *const bx[8],
+                   int b, int e, float *out, const bool bIou);
+void quadRangeAvx512(const float *const ax[8], const float *const bx[8],
+                     int b, int e, float *out, const bool bIou);
+#endif
+}
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+#endif // !_IOU_SIMD_KERNEL_H_FILE_
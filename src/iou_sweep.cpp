@@ -0,0 +1,108 @@
+/***********************************
+ * iou_sweep.cpp
+ *
+ * Find all the overlapping pairs in one set of convex polygons.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "iou_sweep.h"
+#include "iou_clip.h"
+#include "iou_parallel.h"
+#include <algorithm>
+#include <mutex>
+
+namespace IOU
+{
+
+// Pairs buffered by a worker before they are handed to the callback.
+static const int PAIR_BLOCK = 4096;
+
+struct SweepBox {
+    double x0, x1, y0, y1;
+    double area;
+    int id;
+    const Vertexes *vert;  // In anticlockwise, for the clipper.
+};
+
+long long forEachOverlappingPairEx(const std::vector<Vertexes> &Cs,
+                                   const double iouThresh,
+                                   const IouPairCallback &callback)
+{
+    // Bounding boxes of the valid polygons, sorted along x.
+    const int N = Cs.size();
+    std::vector<SweepBox> boxes(N);
+    std::vector<char> valid(N, 0);
+    std::vector<Vertexes> reversed(N);
+    parallelFor(N, [&](int b, int e) {
+        for (int i = b; i < e; ++i) {
+            const Vertexes &C = Cs[i];
+            SweepBox &box = boxes[i];
+            box.id = i;
+            if (C.empty() || !antiClockWise(C, reversed[i], &box.vert))
+                continue;
+            box.area = areaEx(C);
+            box.x0 = box.x1 = C[0].x;
+            box.y0 = box.y1 = C[0].y;
+            for (int k = 1; k < (int)C.size(); ++k) {
+                box.x0 = std::min(box.x0, C[k].x);
+                box.x1 = std::max(box.x1, C[k].x);
+                box.y0 = std::min(box.y0, C[k].y);
+                box.y1 = std::max(box.y1, C[k].y);
+            }
+            valid[i] = 1;
+        }
+    });
+    std::vector<SweepBox> sorted;
+    sorted.reserve(N);
+    for (int i = 0; i < N; ++i) {
+        if (valid[i])
+            sorted.push_back(boxes[i]);
+    }
+    std::sort(sorted.begin(), sorted.end(),
+              [](const SweepBox &a, const SweepBox &b) { return a.x0 < b.x0; });
+
+    // The active set of box k is every later box starting before box k
+    // ends along x. Each worker sweeps its own range of k, so the chunks
+    // are independent.
+    std::mutex mtx;
+    std::atomic<long long> nPairs(0);
+    const int S = sorted.size();
+    parallelFor(S, [&](int b, int e) {
+        std::vector<IouPair> block;
+        block.reserve(PAIR_BLOCK);
+        Vertexes buf0, buf1;
+        auto flush = [&]() {
+            if (block.empty())
+                return;
+            std::lock_guard<std::mutex> lock(mtx);
+            for (int p = 0; p < (int)block.size(); ++p)
+                callback(block[p]);
+            nPairs += block.size();
+            block.clear();
+        };
+        for (int k = b; k < e; ++k) {
+            const SweepBox &bk = sorted[k];
+            for (int l = k + 1; l < S && sorted[l].x0 <= bk.x1 + EPS; ++l) {
+                const SweepBox &bl = sorted[l];
+                if (bl.y0 > bk.y1 + EPS || bk.y0 > bl.y1 + EPS)
+                    continue;
+                const double inter = clipAreaConvex(*bk.vert, *bl.vert, buf0, buf1);
+                if (inter <= 0.0)
+                    continue;
+                const double v = inter / (bk.area + bl.area - inter);
+                if (v > iouThresh) {
+                    block.push_back(IouPair(std::min(bk.id, bl.id), std::max(bk.id, bl.id), v));
+                    if ((int)block.size() >= PAIR_BLOCK)
+                        flush();
+                }
+            }
+        }
+        flush();
+    });
+    return nPairs;
+}
+
+}
@@ -0,0 +1,55 @@
+/***********************************
+ * iou_sweep.h
+ *
+ * Find all the overlapping pairs in one set of convex polygons.
+ * A sweep-and-prune broad phase over the bounding boxes sends only
+ * candidate pairs to the exact iou calculation.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#ifndef _IOU_SWEEP_H_FILE_
+#define _IOU_SWEEP_H_FILE_
+
+#include "iou.h"
+#include <functional>
+
+namespace IOU
+{
+    struct IouPair {
+        // Members
+        int i;      // i < j
+        int j;
+        double iou;
+
+        // Constructors
+        IouPair() : i(-1), j(-1), iou(0) {}
+        IouPair(int _i, int _j, double _iou) : i(_i), j(_j), iou(_iou) {}
+    };
+
+    typedef std::function<void(const IouPair &pair)> IouPairCallback;
+
+    // Call callback for every pair of polygons with iou > iouThresh.
+    // Pairs are found in parallel and handed over in blocks, so the whole
+    // pair list is never held in memory. Calls to callback are serialized,
+    // but come from the worker threads and in no particular order.
+    // Non-convex polygons are skipped.
+    // Return the number of pairs reported.
+    long long forEachOverlappingPairEx(const std::vector<Vertexes> &Cs,
+                                       const double iouThresh,
+                                       const IouPairCallback &callback);
+
+    // Same as above, writing IouPair values to an output iterator.
+    template <typename OutputIt>
+    OutputIt overlappingPairsEx(const std::vector<Vertexes> &Cs,
+                                const double iouThresh,
+                                OutputIt out)
+    {
+        forEachOverlappingPairEx(Cs, iouThresh,
+                                 [&out](const IouPair &pair) { *out++ = pair; });
+        return out;
+    }
+}
+#endif // !_IOU_SWEEP_H_FILE_
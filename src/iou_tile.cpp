@@ -0,0 +1,153 @@
+/***********************************
+ * iou_tile.cpp
+ *
+ * Merge the convex polygons of overlapping tiles of a large scene.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "iou_tile.h"
+#include "iou_clip.h"
+#include "iou_parallel.h"
+#include <algorithm>
+
+namespace IOU
+{
+
+TileMerger::TileMerger(double _tileW, double _tileH, double _overlap, int _nTilesX,
+                       double _iouThresh, const EmitCallback &_emit)
+    : stepX(_tileW - _overlap), stepY(_tileH - _overlap), nTilesX(_nTilesX),
+      iouThresh(_iouThresh), emit(_emit), lastTileDone(-1)
+{
+    assert(stepX > 0.0 && stepY > 0.0 && nTilesX > 0);
+}
+
+bool TileMerger::addTile(int tx, int ty, const Vertexes *polys, const double *scores, int n)
+{
+    const long long tile = (long long)ty * nTilesX + tx;
+    if (tx < 0 || tx >= nTilesX || ty < 0 || tile <= lastTileDone)
+        return false;
+    lastTileDone = tile;
+
+    // Residents sorted along x. A resident can only overlap a box
+    // [x0, x1] if it starts in [x0 - maxW, x1], maxW its widest extent.
+    std::vector<int> byX;
+    std::vector<double> xs;
+    double maxW = 0.0;
+    byX.reserve(residents.size());
+    for (int k = 0; k < (int)residents.size(); ++k) {
+        if (residents[k].area > 0.0) {
+            byX.push_back(k);
+            maxW = std::max(maxW, residents[k].x1 - residents[k].x0);
+        }
+    }
+    std::sort(byX.begin(), byX.end(),
+              [&](int a, int b) { return residents[a].x0 < residents[b].x0; });
+    xs.resize(byX.size());
+    for (int k = 0; k < (int)byX.size(); ++k)
+        xs[k] = residents[byX[k]].x0;
+
+    // Bounding boxes of the new polygons, and the residents they overlap.
+    // Residents all come from earlier tiles, and are only read here.
+    std::vector<Resident> incoming(n);
+    std::vector<std::vector<int> > overlaps(n);
+    parallelFor(n, [&](int b, int e) {
+        Vertexes buf0, buf1;
+        for (int i = b; i < e; ++i) {
+            Resident &r = incoming[i];
+            r.vert = polys[i];
+            r.score = scores[i];
+            const Vertexes *pC = 0;
+            r.area = antiClockWise(r.vert, r.ccw, &pC) ? areaEx(r.vert) : -1.0;
+            if (r.vert.empty()) {
+                r.x0 = r.x1 = r.y0 = r.y1 = 0.0;
+                r.lastTile = tile;
+                continue;
+            }
+            r.x0 = r.x1 = r.vert[0].x;
+            r.y0 = r.y1 = r.vert[0].y;
+            for (int k = 1; k < (int)r.vert.size(); ++k) {
+                r.x0 = std::min(r.x0, r.vert[k].x);
+                r.x1 = std::max(r.x1, r.vert[k].x);
+                r.y0 = std::min(r.y0, r.vert[k].y);
+                r.y1 = std::max(r.y1, r.vert[k].y);
+            }
+            const long long lastX = std::min<long long>(nTilesX - 1, (long long)floor(r.x1 / stepX));
+            const long long lastY = (long long)floor(r.y1 / stepY);
+            r.lastTile = std::max(tile, lastY * nTilesX + lastX);
+
+            if (r.area <= 0.0)
+                continue;
+            const Vertexes &rv = r.ccw.empty() ? r.vert : r.ccw;
+            const int kBegin = std::lower_bound(xs.begin(), xs.end(), r.x0 - maxW - EPS) - xs.begin();
+            const int kEnd = std::upper_bound(xs.begin(), xs.end(), r.x1 + EPS) - xs.begin();
+            for (int k = kBegin; k < kEnd; ++k) {
+                const Resident &o = residents[byX[k]];
+                if (o.x1 < r.x0 - EPS || o.y0 > r.y1 + EPS || r.y0 > o.y1 + EPS)
+                    continue;
+                const Vertexes &ov = o.ccw.empty() ? o.vert : o.ccw;
+                const double inter = clipAreaConvex(rv, ov, buf0, buf1);
+                if (inter > 0.0 && inter / (r.area + o.area - inter) > iouThresh)
+                    overlaps[i].push_back(byX[k]);
+            }
+        }
+    });
+
+    // Resolve by decreasing score, as greedy suppression would.
+    std::vector<int> order(n);
+    for (int i = 0; i < n; ++i)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(),
+                     [&](int a, int b) { return incoming[a].score > incoming[b].score; });
+    std::vector<char> dead(residents.size(), 0);
+    std::vector<char> dropped(n, 0);
+    for (int k = 0; k < n; ++k) {
+        const int i = order[k];
+        bool bDrop = false;
+        for (int o = 0; o < (int)overlaps[i].size(); ++o) {
+            const int r = overlaps[i][o];
+            if (!dead[r] && residents[r].score >= incoming[i].score) {
+                bDrop = true;
+                break;
+            }
+        }
+        if (bDrop) {
+            dropped[i] = 1;
+            continue;
+        }
+        for (int o = 0; o < (int)overlaps[i].size(); ++o)
+            dead[overlaps[i][o]] = 1;
+    }
+
+    // Emit what no later tile can touch, keep the rest.
+    std::vector<Resident> kept;
+    for (int k = 0; k < (int)residents.size(); ++k) {
+        if (dead[k])
+            continue;
+        if (residents[k].lastTile <= tile)
+            emit(residents[k].vert, residents[k].score);
+        else
+            kept.push_back(residents[k]);
+    }
+    for (int i = 0; i < n; ++i) {
+        if (dropped[i])
+            continue;
+        if (incoming[i].lastTile <= tile)
+            emit(incoming[i].vert, incoming[i].score);
+        else
+            kept.push_back(incoming[i]);
+    }
+    residents.swap(kept);
+    return true;
+}
+
+void TileMerger::finish()
+{
+    for (int k = 0; k < (int)residents.size(); ++k)
+        emit(residents[k].vert, residents[k].score);
+    std::vector<Resident>().swap(residents);
+}
+
+}
@@ -0,0 +1,65 @@
+/***********************************
+ * iou_tile.h
+ *
+ * Merge the convex polygons of overlapping tiles of a large scene,
+ * tile by tile. Duplicates across tile borders are suppressed by iou,
+ * and a polygon is emitted as soon as no later tile can touch it,
+ * so only the polygons in the border bands stay in memory.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#ifndef _IOU_TILE_H_FILE_
+#define _IOU_TILE_H_FILE_
+
+#include "iou.h"
+#include <functional>
+
+namespace IOU
+{
+    class TileMerger {
+    public:
+        typedef std::function<void(const Vertexes &C, double score)> EmitCallback;
+
+        // Tile (tx, ty) covers [tx*(tileW-overlap), tx*(tileW-overlap)+tileW] along x,
+        // and the same along y, in scene coordinates. There are nTilesX tiles per row.
+        // Of two polygons from different tiles with iou > iouThresh,
+        // the one of lower score is dropped.
+        TileMerger(double _tileW, double _tileH, double _overlap, int _nTilesX,
+                   double _iouThresh, const EmitCallback &_emit);
+
+        // Add the polygons of one tile, in scene coordinates.
+        // Tiles must arrive in raster order (row by row); empty tiles may be skipped.
+        // Return false, and ignore the tile, if it is out of order or out of range.
+        bool addTile(int tx, int ty, const Vertexes *polys, const double *scores, int n);
+        bool addTile(int tx, int ty, const std::vector<Vertexes> &polys, const std::vector<double> &scores) {
+            assert(polys.size() == scores.size());
+            return addTile(tx, ty, polys.data(), scores.data(), polys.size()); }
+
+        // Emit all the polygons still held. Call after the last tile.
+        void finish();
+
+        int residentCount() const { return residents.size(); }
+
+    private:
+        struct Resident {
+            Vertexes vert;
+            Vertexes ccw;       // vert in anticlockwise for the clipper, empty if it already is.
+            double score;
+            double area;
+            double x0, x1, y0, y1;
+            long long lastTile; // Raster index of the last tile that can touch it.
+        };
+
+        double stepX;
+        double stepY;
+        int nTilesX;
+        double iouThresh;
+        EmitCallback emit;
+        long long lastTileDone;
+        std::vector<Resident> residents;
+    };
+}
+#endif // !_IOU_TILE_H_FILE_
@@ -0,0 +1,475 @@
+/***********************************
+ * iou_union.cpp
+ *
+ * Area of the union of many convex polygons.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "iou_union.h"
+#include "iou_parallel.h"
+#include <algorithm>
+
+namespace IOU
+{
+
+// Covered areas summed by the sweep.
+enum CoverKind
+{
+    CoverSet1,
+    CoverSet2,
+    CoverBoth,
+    CoverEither,
+    CoverKinds
+};
+
+// A non-vertical polygon edge with x0 < x1, on y - yc = alpha + beta * (x - xc)
+// for a point (xc, yc) in the middle of all the edges.
+struct SweepEdge {
+    double x0, y0;
+    double x1, y1;
+    double alpha, beta;
+    int weight;  // +1 for a lower boundary, -1 for an upper boundary.
+    int set;     // 0 or 1.
+
+    double yAt(double x) const { return y0 + (y1 - y0) * (x - x0) / (x1 - x0); }
+};
+
+// Where two adjacent edges swap, a below b until then.
+// Stale once they are no longer adjacent.
+struct SweepCrossing {
+    double x;
+    int a;
+    int b;
+
+    bool operator<(const SweepCrossing &c) const { return x > c.x; }  // Earliest first.
+};
+
+static bool collectSweepEdges(const std::vector<Vertexes> &Cs, const int set,
+                              std::vector<SweepEdge> &edges, std::vector<double> &xs)
+{
+    for (int i = 0; i < (int)Cs.size(); ++i) {
+        const Vertexes &C = Cs[i];
+        const WiseType wiseType = whichWiseEx(C);
+        if (wiseType == NoneWise)
+            return false;
+        const int flip = (wiseType == AntiClockWise) ? 1 : -1;
+        const int N = C.size();
+        for (int k = 0; k < N; ++k) {
+            const Point &a = C[k];
+            const Point &b = C[(k + 1) % N];
+            xs.push_back(a.x);
+            if (a.x == b.x)
+                continue;
+            SweepEdge e;
+            e.set = set;
+            if (a.x < b.x) {
+                e.x0 = a.x; e.y0 = a.y;
+                e.x1 = b.x; e.y1 = b.y;
+                e.weight = flip;
+            }
+            else {
+                e.x0 = b.x; e.y0 = b.y;
+                e.x1 = a.x; e.y1 = a.y;
+                e.weight = -flip;
+            }
+            edges.push_back(e);
+        }
+    }
+    return true;
+}
+
+// A run of edges in y order, for one cover kind: w is the step of the
+// winding count over the run, and m the lowest count in it, from 0 below
+// the run. a + b * x sums y(x) of the edges where the count comes down
+// to m, less the ones where it leaves m. Over all the edges m is 0, as
+// counts are never negative, and a + b * x is the covered length at x.
+struct CoverRun {
+    int w;
+    int m;
+    double a, b;
+};
+
+static CoverRun edgeRun(const SweepEdge &e, const int w)
+{
+    CoverRun r;
+    r.w = w;
+    r.m = std::min(w, 0);
+    r.a = w > 0 ? -e.alpha : (w < 0 ? e.alpha : 0.0);
+    r.b = w > 0 ? -e.beta : (w < 0 ? e.beta : 0.0);
+    return r;
+}
+static CoverRun joinRuns(const CoverRun &lo, const CoverRun &hi)
+{
+    CoverRun r;
+    r.w = lo.w + hi.w;
+    r.m = std::min(lo.m, lo.w + hi.m);
+    r.a = (lo.m == r.m ? lo.a : 0.0) + (lo.w + hi.m == r.m ? hi.a : 0.0);
+    r.b = (lo.m == r.m ? lo.b : 0.0) + (lo.w + hi.m == r.m ? hi.b : 0.0);
+    return r;
+}
+
+// The edges under the sweep line in y order, in a treap whose nodes hold
+// the runs of their subtrees for set 1, set 2 and either set. Inserting,
+// erasing and swapping two adjacent edges cost O(log n), and the covered
+// lengths are read at the root.
+class SweepOrder {
+public:
+    explicit SweepOrder(const std::vector<SweepEdge> &_edges)
+        : edges(_edges), slots(_edges.size(), -1), root(-1), seed(2463534242u) {}
+
+    // Edge e at its y at x, after the edges at the same y that rise slower.
+    void insert(const int e, const double x)
+    {
+        const int v = nodes.size();
+        Node n;
+        n.l = n.r = n.p = -1;
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        n.prio = seed;
+        n.edge = e;
+        nodes.push_back(n);
+        slots[e] = v;
+        pull(v);
+        int lo, hi;
+        split(root, e, x, lo, hi);
+        setRoot(merge(merge(lo, v), hi));
+    }
+    void erase(const int e)
+    {
+        const int v = slots[e];
+        const int t = merge(nodes[v].l, nodes[v].r);
+        const int p = nodes[v].p;
+        if (t >= 0)
+            nodes[t].p = p;
+        if (p < 0)
+            root = t;
+        else if (nodes[p].l == v)
+            nodes[p].l = t;
+        else
+            nodes[p].r = t;
+        pullUp(p);
+        slots[e] = -1;
+    }
+    // Swap edge e with the one above it.
+    void swapUp(const int e)
+    {
+        const int v = slots[e];
+        const int u = next(v);
+        const int f = nodes[u].edge;
+        nodes[v].edge = f;
+        nodes[u].edge = e;
+        slots[f] = v;
+        slots[e] = u;
+        pullUp(v);
+        pullUp(u);
+    }
+    // The edges next to e, or -1.
+    int above(const int e) const
+    {
+        const int u = next(slots[e]);
+        return u < 0 ? -1 : nodes[u].edge;
+    }
+    int below(const int e) const
+    {
+        const int u = prev(slots[e]);
+        return u < 0 ? -1 : nodes[u].edge;
+    }
+    // The lowest edge, or -1.
+    int lowest() const
+    {
+        int v = root;
+        while (v >= 0 && nodes[v].l >= 0)
+            v = nodes[v].l;
+        return v < 0 ? -1 : nodes[v].edge;
+    }
+    // Runs of all the edges, for set 1, set 2 and either set.
+    void runs(CoverRun r[3]) const
+    {
+        for (int k = 0; k < 3; ++k) {
+            if (root >= 0)
+                r[k] = nodes[root].runs[k];
+            else
+                r[k].w = r[k].m = 0, r[k].a = r[k].b = 0.0;
+        }
+    }
+
+private:
+    struct Node {
+        int l, r, p;
+        unsigned prio;
+        int edge;
+        CoverRun runs[3];
+    };
+    const std::vector<SweepEdge> &edges;
+    std::vector<Node> nodes;
+    std::vector<int> slots;  // Node of each edge, or -1.
+    int root;
+    unsigned seed;
+
+    void pull(const int v)
+    {
+        Node &n = nodes[v];
+        const SweepEdge &e = edges[n.edge];
+        for (int k = 0; k < 3; ++k) {
+            CoverRun r = edgeRun(e, (k == 2 || k == e.set) ? e.weight : 0);
+            if (n.l >= 0)
+                r = joinRuns(nodes[n.l].runs[k], r);
+            if (n.r >= 0)
+                r = joinRuns(r, nodes[n.r].runs[k]);
+            n.runs[k] = r;
+        }
+    }
+    void pullUp(int v)
+    {
+        for (; v >= 0; v = nodes[v].p)
+            pull(v);
+    }
+    void setRoot(const int v)
+    {
+        root = v;
+        if (v >= 0)
+            nodes[v].p = -1;
+    }
+    int merge(const int a, const int b)
+    {
+        if (a < 0)
+            return b;
+        if (b < 0)
+            return a;
+        if (nodes[a].prio > nodes[b].prio) {
+            const int t = merge(nodes[a].r, b);
+            nodes[a].r = t;
+            nodes[t].p = a;
+            pull(a);
+            return a;
+        }
+        const int t = merge(a, nodes[b].l);
+        nodes[b].l = t;
+        nodes[t].p = b;
+        pull(b);
+        return b;
+    }
+    // The edges of subtree v below edge e at x, and the others.
+    void split(const int v, const int e, const double x, int &lo, int &hi)
+    {
+        if (v < 0) {
+            lo = hi = -1;
+            return;
+        }
+        const SweepEdge &a = edges[nodes[v].edge];
+        const SweepEdge &b = edges[e];
+        const double ya = a.yAt(x);
+        const double yb = b.yAt(x);
+        if (ya < yb || (ya == yb && a.beta <= b.beta)) {
+            int t;
+            split(nodes[v].r, e, x, t, hi);
+            nodes[v].r = t;
+            if (t >= 0)
+                nodes[t].p = v;
+            pull(v);
+            lo = v;
+        }
+        else {
+            int t;
+            split(nodes[v].l, e, x, lo, t);
+            nodes[v].l = t;
+            if (t >= 0)
+                nodes[t].p = v;
+            pull(v);
+            hi = v;
+        }
+    }
+    int next(int v) const
+    {
+        if (nodes[v].r >= 0) {
+            for (v = nodes[v].r; nodes[v].l >= 0; v = nodes[v].l) {}
+            return v;
+        }
+        while (nodes[v].p >= 0 && nodes[nodes[v].p].r == v)
+            v = nodes[v].p;
+        return nodes[v].p;
+    }
+    int prev(int v) const
+    {
+        if (nodes[v].l >= 0) {
+            for (v = nodes[v].l; nodes[v].r >= 0; v = nodes[v].r) {}
+            return v;
+        }
+        while (nodes[v].p >= 0 && nodes[nodes[v].p].l == v)
+            v = nodes[v].p;
+        return nodes[v].p;
+    }
+};
+
+// Queue the swap of adjacent edges a (below) and b (above), if a is above
+// b where the first of them ends, at the x where they cross after x.
+static void pushCrossing(const std::vector<SweepEdge> &edges, const int a, const int b,
+                         const double x, std::vector<SweepCrossing> &heap)
+{
+    if (a < 0 || b < 0)
+        return;
+    const SweepEdge &ea = edges[a];
+    const SweepEdge &eb = edges[b];
+    const double xe = std::min(ea.x1, eb.x1);
+    const double dr = ea.yAt(xe) - eb.yAt(xe);
+    if (!(dr > 0.0))
+        return;
+    const double dl = std::max(0.0, eb.yAt(x) - ea.yAt(x));
+    SweepCrossing c;
+    c.x = std::min(xe, x + (xe - x) * (dl / (dl + dr)));
+    c.a = a;
+    c.b = b;
+    heap.push_back(c);
+    std::push_heap(heap.begin(), heap.end());
+}
+
+// Add the covered areas between x0 and x1, for lines taken about x = xc.
+static void integrate(const SweepOrder &order, const double x0, const double x1, const double xc,
+                      double area[CoverKinds])
+{
+    CoverRun r[3];
+    order.runs(r);
+    const double xm = (x0 + x1) * 0.5 - xc;
+    double len[3];
+    for (int k = 0; k < 3; ++k)
+        len[k] = (x1 - x0) * (r[k].a + r[k].b * xm);
+    area[CoverSet1] += len[0];
+    area[CoverSet2] += len[1];
+    area[CoverEither] += len[2];
+    area[CoverBoth] += len[0] + len[1] - len[2];
+}
+
+static bool coverAreas(const std::vector<Vertexes> &Cs1, const std::vector<Vertexes> &Cs2,
+                       double area[CoverKinds])
+{
+    for (int k = 0; k < CoverKinds; ++k)
+        area[k] = 0.0;
+
+    std::vector<SweepEdge> edges;
+    std::vector<double> xs;
+    if (!collectSweepEdges(Cs1, 0, edges, xs) ||
+        !collectSweepEdges(Cs2, 1, edges, xs))
+        return false;
+    std::sort(xs.begin(), xs.end());
+    xs.erase(std::unique(xs.begin(), xs.end()), xs.end());
+    std::sort(edges.begin(), edges.end(),
+              [](const SweepEdge &a, const SweepEdge &b) { return a.x0 < b.x0; });
+
+    // The lines are taken about the middle of the edges, for fewer digits
+    // lost in alpha + beta * (x - xc).
+    const int E = edges.size();
+    double y0 = E > 0 ? edges[0].y0 : 0.0, y1 = y0;
+    for (int i = 0; i < E; ++i) {
+        y0 = std::min(y0, std::min(edges[i].y0, edges[i].y1));
+        y1 = std::max(y1, std::max(edges[i].y0, edges[i].y1));
+    }
+    const double xc = xs.empty() ? 0.0 : (xs.front() + xs.back()) * 0.5;
+    const double yc = (y0 + y1) * 0.5;
+    for (int i = 0; i < E; ++i) {
+        SweepEdge &e = edges[i];
+        e.beta = (e.y1 - e.y0) / (e.x1 - e.x0);
+        e.alpha = (e.y0 - yc) - e.beta * (e.x0 - xc);
+    }
+    std::vector<int> byEnd(E);
+    for (int i = 0; i < E; ++i)
+        byEnd[i] = i;
+    std::sort(byEnd.begin(), byEnd.end(), [&](int a, int b) { return edges[a].x1 < edges[b].x1; });
+
+    // Each block of slabs sweeps from its first x, and costs O(E) to
+    // start, so there are only two blocks a thread.
+    const int S = (int)xs.size() - 1;
+    std::vector<double> slabArea((size_t)std::max(S, 0) * CoverKinds, 0.0);
+    parallelFor(S, [&](int b, int e) {
+        // Edges spanning the first slab of the block.
+        SweepOrder order(edges);
+        std::vector<SweepCrossing> heap;
+        int p = 0;
+        for (; p < E && edges[p].x0 <= xs[b]; ++p) {
+            if (edges[p].x1 > xs[b])
+                order.insert(p, xs[b]);
+        }
+        for (int i = order.lowest(); i >= 0; i = order.above(i))
+            pushCrossing(edges, i, order.above(i), xs[b], heap);
+        int q = std::upper_bound(byEnd.begin(), byEnd.end(), xs[b],
+                                 [&](double x, int i) { return x < edges[i].x1; }) - byEnd.begin();
+
+        // Crossings are taken in x order, each one a swap of two adjacent
+        // edges. Edges ending are erased, and edges starting inserted at
+        // their y, at the end of each slab.
+        double x = xs[b];
+        for (int s = b; s < e; ++s) {
+            const double xr = xs[s + 1];
+            double *sArea = &slabArea[(size_t)s * CoverKinds];
+            while (!heap.empty() && heap.front().x <= xr) {
+                std::pop_heap(heap.begin(), heap.end());
+                const SweepCrossing c = heap.back();
+                heap.pop_back();
+                if (order.above(c.a) != c.b)
+                    continue;
+                const double xt = std::max(x, c.x);
+                integrate(order, x, xt, xc, sArea);
+                x = xt;
+                order.swapUp(c.a);
+                pushCrossing(edges, order.below(c.b), c.b, x, heap);
+                pushCrossing(edges, c.a, order.above(c.a), x, heap);
+            }
+            integrate(order, x, xr, xc, sArea);
+            x = xr;
+            if (s + 1 == e)
+                break;
+            for (; q < E && edges[byEnd[q]].x1 <= xr; ++q) {
+                const int lo = order.below(byEnd[q]);
+                const int hi = order.above(byEnd[q]);
+                order.erase(byEnd[q]);
+                pushCrossing(edges, lo, hi, x, heap);
+            }
+            for (; p < E && edges[p].x0 <= xr; ++p) {
+                order.insert(p, xr);
+                pushCrossing(edges, order.below(p), p, x, heap);
+                pushCrossing(edges, p, order.above(p), x, heap);
+            }
+        }
+    }, std::max(1, S / (2 * numThreads())));
+
+    for (int s = 0; s < S; ++s) {
+        for (int k = 0; k < CoverKinds; ++k)
+            area[k] += slabArea[(size_t)s * CoverKinds + k];
+    }
+    return true;
+}
+
+double areaUnionEx(const std::vector<Vertexes> &Cs)
+{
+    double area[CoverKinds];
+    if (!coverAreas(Cs, std::vector<Vertexes>(), area))
+        return -1.0;
+    return area[CoverSet1];
+}
+
+double areaIntersectionEx(const std::vector<Vertexes> &Cs1, const std::vector<Vertexes> &Cs2)
+{
+    double area[CoverKinds];
+    if (!coverAreas(Cs1, Cs2, area))
+        return -1.0;
+    return area[CoverBoth];
+}
+double areaUnionEx(const std::vector<Vertexes> &Cs1, const std::vector<Vertexes> &Cs2)
+{
+    double area[CoverKinds];
+    if (!coverAreas(Cs1, Cs2, area))
+        return -1.0;
+    return area[CoverEither];
+}
+double iouEx(const std::vector<Vertexes> &Cs1, const std::vector<Vertexes> &Cs2)
+{
+    double area[CoverKinds];
+    if (!coverAreas(Cs1, Cs2, area))
+        return -1.0;
+    return area[CoverEither] > 0.0 ? area[CoverBoth] / area[CoverEither] : 0.0;
+}
+
+}
@@ -0,0 +1,36 @@
+/***********************************
+ * iou_union.h
+ *
+ * Area of the union of many convex polygons,
+ * and the iou ratio of two polygon sets (union vs. union).
+ *
+ * A line sweeps along x over the polygon edges, kept in y order in a
+ * balanced tree whose subtrees sum their winding counts and covered
+ * lengths. Between two events the covered lengths along y are linear
+ * in x. Edges starting, ending and crossing, taken in x order, each
+ * update the tree in O(log n), so n edges with k crossings cost
+ * O((n + k) log n). Blocks of slabs between vertexes are swept in
+ * parallel.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#ifndef _IOU_UNION_H_FILE_
+#define _IOU_UNION_H_FILE_
+
+#include "iou.h"
+
+namespace IOU
+{
+    // Return -1.0 if any polygon is non-convex.
+    double areaUnionEx(const std::vector<Vertexes> &Cs);
+
+    // Area(U1*U2), Area(U1+U2) and iou of U1 and U2,
+    // where U1 and U2 are the unions of Cs1 and Cs2.
+    double areaIntersectionEx(const std::vector<Vertexes> &Cs1, const std::vector<Vertexes> &Cs2);
+    double areaUnionEx(const std::vector<Vertexes> &Cs1, const std::vector<Vertexes> &Cs2);
+    double iouEx(const std::vector<Vertexes> &Cs1, const std::vector<Vertexes> &Cs2);
+}
+#endif // !_IOU_UNION_H_FILE_
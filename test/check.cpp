@@ -0,0 +1,82 @@
+/***********************************
+ * check.cpp
+ *
+ * Helpers of the checks.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "check.h"
+
+#include <cstdio>
+#include <algorithm>
+#include <random>
+
+std::mt19937 _check_engine(2018);
+
+double checkRand(const double a, const double b)
+{
+    return std::uniform_real_distribution<double>(a, b)(_check_engine);
+}
+int checkRandInt(const int n)
+{
+    return std::uniform_int_distribution<int>(0, n - 1)(_check_engine);
+}
+
+void checkRectangle(const Point &c, const double l, const double w, const double t, Vertexes &C)
+{
+    const Point u(cos(t) * l * 0.5, sin(t) * l * 0.5);
+    const Point v(-sin(t) * w * 0.5, cos(t) * w * 0.5);
+    Vertexes _C;
+    _C.push_back(c - u - v);
+    _C.push_back(c + u - v);
+    _C.push_back(c + u + v);
+    _C.push_back(c - u + v);
+    C.swap(_C);
+}
+void checkConvex(const Point &c, const double rx, const double ry, const int n, Vertexes &C)
+{
+    std::vector<double> angles(n);
+    for (int i = 0; i < n; ++i)
+        angles[i] = checkRand(0.0, 2.0 * M_PI);
+    std::sort(angles.begin(), angles.end());
+    Vertexes _C(n);
+    for (int i = 0; i < n; ++i)
+        _C[i] = c + Point(rx * cos(angles[i]), ry * sin(angles[i]));
+    C.swap(_C);
+}
+bool checkInside(const Vertexes &C, const Point &p)
+{
+    const int N = C.size();
+    bool bPos = true;
+    bool bNeg = true;
+    for (int i = 0; i < N; ++i) {
+        const double d = (C[(i + 1) % N] - C[i]) ^ (p - C[i]);
+        bPos = bPos && d >= 0.0;
+        bNeg = bNeg && d <= 0.0;
+    }
+    return N > 2 && (bPos || bNeg);
+}
+double checkSampledArea(const std::function<bool(const Point &)> &inside,
+                        const double x0, const double y0, const double x1, const double y1,
+                        const int n)
+{
+    const double dx = (x1 - x0) / n;
+    const double dy = (y1 - y0) / n;
+    int nIn = 0;
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j)
+            nIn += inside(Point(x0 + (i + 0.5) * dx, y0 + (j + 0.5) * dy));
+    }
+    return nIn * dx * dy;
+}
+
+bool checkReport(const char *name, const int nFailed, const int nChecked)
+{
+    printf("Check %-12s %8d cases  %s\n", name, nChecked, nFailed == 0 ? "OK" : "FAILED");
+    if (nFailed != 0)
+        printf("--  [%d] Errors in %s, Please Check Me. --\n", nFailed, name);
+    return nFailed == 0;
+}
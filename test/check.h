@@ -0,0 +1,50 @@
+/***********************************
+ * check.h
+ *
+ * Checks of the extra modules against brute force.
+ * No image is drawn, each check prints one line and returns
+ * whether it passed.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+#ifndef _IOU_CHECK_H_FILE_
+#define _IOU_CHECK_H_FILE_
+
+#include <functional>
+#include "../src/iou.h"
+
+using namespace IOU;
+
+// Helpers
+double checkRand(const double a, const double b);
+int checkRandInt(const int n);
+// Rectangle centered at c, l along the angle t and w across, in anticlockwise.
+void checkRectangle(const Point &c, const double l, const double w, const double t, Vertexes &C);
+// Convex polygon of n vertexes on an ellipse around c, in anticlockwise.
+void checkConvex(const Point &c, const double rx, const double ry, const int n, Vertexes &C);
+// Inside a convex polygon in either wise, boundary included.
+bool checkInside(const Vertexes &C, const Point &p);
+// Area of {p : inside(p)} in the box [x0, x1] x [y0, y1], sampled on an n x n grid.
+double checkSampledArea(const std::function<bool(const Point &)> &inside,
+                        const double x0, const double y0, const double x1, const double y1,
+                        const int n);
+bool checkReport(const char *name, const int nFailed, const int nChecked);
+
+// Checks
+bool checkBox3d();
+bool checkSweep();
+bool checkTile();
+bool checkUnion();
+bool checkLocate();
+bool checkGjk();
+bool checkSimd();
+bool checkEngine();
+bool checkService();
+bool checkDecompose();
+bool checkCompact();
+bool checkIngest();
+bool checkRle();
+
+#endif // !_IOU_CHECK_H_FILE_
@@ -0,0 +1,162 @@
+/***********************************
+ * check_box3d.cpp
+ *
+ * Checks of iou_box3d.h.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "check.h"
+#include "../src/iou_box3d.h"
+
+#include <algorithm>
+
+static Box3d randomBox3d(const double range)
+{
+    return Box3d(checkRand(0.0, range), checkRand(0.0, range), checkRand(0.0, 2.0),
+                 checkRand(1.0, 5.0), checkRand(1.0, 3.0), checkRand(0.5, 2.0),
+                 checkRand(-M_PI, M_PI));
+}
+static void footprint(const Box3d &B, Vertexes &C)
+{
+    checkRectangle(Point(B.x, B.y), B.l, B.w, B.yaw, C);
+}
+static double sampledIouBev(const Box3d &B1, const Box3d &B2)
+{
+    Vertexes C1, C2;
+    footprint(B1, C1);
+    footprint(B2, C2);
+    const double r = B1.radius() + B2.radius();
+    const double x0 = std::min(B1.x, B2.x) - r;
+    const double y0 = std::min(B1.y, B2.y) - r;
+    const double x1 = std::max(B1.x, B2.x) + r;
+    const double y1 = std::max(B1.y, B2.y) + r;
+    const double inter = checkSampledArea([&](const Point &p) {
+        return checkInside(C1, p) && checkInside(C2, p); }, x0, y0, x1, y1, 400);
+    return inter / (B1.bevArea() + B2.bevArea() - inter);
+}
+
+// Greedy NMS and matching, pair by pair.
+static void bruteNms(const std::vector<Box3d> &boxes, const std::vector<double> &scores,
+                     const double thresh, std::vector<int> &keep)
+{
+    std::vector<int> order(boxes.size());
+    for (int i = 0; i < (int)order.size(); ++i)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return scores[a] > scores[b]; });
+    keep.clear();
+    for (int k = 0; k < (int)order.size(); ++k) {
+        const int i = order[k];
+        bool bKeep = true;
+        for (int s = 0; s < (int)keep.size() && bKeep; ++s)
+            bKeep = !(iou3d(boxes[i], boxes[keep[s]]) > thresh);
+        if (bKeep)
+            keep.push_back(i);
+    }
+}
+static int bruteMatch(const std::vector<Box3d> &dets, const std::vector<double> &scores,
+                      const std::vector<Box3d> &gts, const double thresh, std::vector<int> &matches)
+{
+    std::vector<int> order(dets.size());
+    for (int i = 0; i < (int)order.size(); ++i)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return scores[a] > scores[b]; });
+    matches.assign(dets.size(), -1);
+    std::vector<char> taken(gts.size(), 0);
+    int nMatched = 0;
+    for (int k = 0; k < (int)order.size(); ++k) {
+        const int i = order[k];
+        double best = 0.0;
+        for (int j = 0; j < (int)gts.size(); ++j) {
+            const double v = iou3d(dets[i], gts[j]);
+            if (!taken[j] && v >= thresh && v > best) {
+                best = v;
+                matches[i] = j;
+            }
+        }
+        if (matches[i] >= 0) {
+            taken[matches[i]] = 1;
+            ++nMatched;
+        }
+    }
+    return nMatched;
+}
+
+bool checkBox3d()
+{
+    int nFailed = 0;
+    int nChecked = 0;
+
+    // Overlapping pair the quad intersection used to fail on.
+    const Box3d a(43.206615739656371, 133.54667951017464, 1.7628653195621184,
+                  3.5750039477260844, 1.8257088150473779, 1.5, 4.362533428712835);
+    const Box3d b(43.452591124229592, 135.25970293598346, 0.45605385770141088,
+                  3.1026749595991667, 1.6917455465816551, 1.5, 1.9230464733784725);
+    nFailed += !(abs(iouBev(a, b) - sampledIouBev(a, b)) < 0.01);
+    nFailed += !(iou3d(a, b) > 0.0);
+    nChecked += 2;
+
+    // Degenerate and exact cases.
+    const Box3d c(0.0, 0.0, 0.0, 4.0, 2.0, 1.0, 0.3);
+    nFailed += !(iouBev(c, Box3d(0.0, 0.0, 0.0, 0.0, 2.0, 1.0, 0.3)) == -1.0);
+    nFailed += !(abs(iou3d(c, c) - 1.0) < 1e-9);
+    nFailed += !(abs(iou3d(c, Box3d(0.0, 0.0, 0.0, 4.0, 2.0, 1.0, 0.3 + M_PI)) - 1.0) < 1e-9);
+    nFailed += !(abs(iou3d(c, Box3d(0.0, 0.0, 0.0, 2.0, 1.0, 1.0, 0.3)) - 0.25) < 1e-9);
+    nFailed += !(abs(iou3d(c, Box3d(0.0, 0.0, 0.5, 4.0, 2.0, 1.0, 0.3)) - 1.0 / 3.0) < 1e-9);
+    nFailed += !(iou3d(c, Box3d(0.0, 0.0, 1.0, 4.0, 2.0, 1.0, 0.3)) == 0.0);
+    nFailed += !(abs(iouBev(c, Box3d(4.0 * cos(0.3), 4.0 * sin(0.3), 0.0, 4.0, 2.0, 1.0, 0.3))) < 1e-9);
+    nFailed += !(abs(iouBev(Box3d(0, 0, 0, 2, 2, 1, 0), Box3d(0, 0, 0, 2, 2, 1, M_PI / 4)) -
+                     (8.0 * (sqrt(2.0) - 1.0)) / (8.0 - 8.0 * (sqrt(2.0) - 1.0))) < 1e-9);
+    nChecked += 8;
+
+    // Rotated boxes against sampling.
+    for (int k = 0; k < 200; ++k) {
+        const Box3d B1 = randomBox3d(6.0);
+        const Box3d B2 = randomBox3d(6.0);
+        nFailed += !(abs(iouBev(B1, B2) - sampledIouBev(B1, B2)) < 0.01);
+        ++nChecked;
+    }
+    // No -1.0 for valid boxes.
+    std::vector<Box3d> boxes(3000);
+    std::vector<double> scores(boxes.size());
+    for (int i = 0; i < (int)boxes.size(); ++i) {
+        boxes[i] = randomBox3d(60.0);
+        scores[i] = checkRand(0.0, 1.0);
+    }
+    std::vector<double> ious;
+    iouBox3dBatch(boxes, boxes, ious, BevMode);
+    int nBad = 0;
+    for (int k = 0; k < (int)ious.size(); ++k)
+        nBad += !(ious[k] >= 0.0 && ious[k] <= 1.0 + 1e-9);
+    nFailed += nBad > 0;
+    ++nChecked;
+
+    // NMS and matching against the greedy passes, with a few long boxes
+    // well above the typical size.
+    for (int i = 0; i < (int)boxes.size(); i += 50)
+        boxes[i].l = checkRand(10.0, 60.0);
+    for (int m = 0; m < 2; ++m) {
+        const Box3dMode mode = m == 0 ? VolumeMode : BevMode;
+        std::vector<int> keep, keepRef;
+        nmsBox3d(boxes, scores, 0.1, keep, mode);
+        if (mode == VolumeMode) {
+            bruteNms(boxes, scores, 0.1, keepRef);
+            nFailed += !(keep == keepRef);
+            ++nChecked;
+        }
+        nFailed += keep.empty();
+        ++nChecked;
+    }
+    std::vector<Box3d> gts(boxes.begin(), boxes.begin() + 1000);
+    std::vector<Box3d> dets(boxes.begin() + 1000, boxes.end());
+    std::vector<double> detScores(scores.begin() + 1000, scores.end());
+    std::vector<int> matches, matchesRef;
+    const int nMatched = matchBox3d(dets, detScores, gts, 0.05, matches);
+    const int nMatchedRef = bruteMatch(dets, detScores, gts, 0.05, matchesRef);
+    nFailed += !(nMatched == nMatchedRef && matches == matchesRef && nMatched > 0);
+    ++nChecked;
+
+    return checkReport("box3d", nFailed, nChecked);
+}
@@ -0,0 +1,123 @@
+/***********************************
+ * check_compact.cpp
+ *
+ * Checks of iou_compact.h.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "check.h"
+#include "../src/iou_clip.h"
+#include "../src/iou_compact.h"
+
+#include <algorithm>
+
+static double perimeter(const Vertexes &C)
+{
+    double s = 0.0;
+    for (int k = 0; k < (int)C.size(); ++k)
+        s += C[k].distance(C[(k + 1) % C.size()]);
+    return s;
+}
+
+bool checkCompact()
+{
+    int nFailed = 0;
+    int nChecked = 0;
+
+    // Small and large polygons, near the origin and far from it. Smaller
+    // ones would meet the absolute EPS of whichWiseEx().
+    const double scales[3] = { 0.1, 1.0, 500.0 };
+    const double offsets[3] = { 0.0, 1e3, 1e5 };
+    for (int s = 0; s < 3; ++s) {
+        for (int o = 0; o < 3; ++o) {
+            const double r = scales[s];
+            std::vector<Vertexes> C1s(40), C2s(40);
+            CompactPolygonSet S1, S2;
+            for (int i = 0; i < 40; ++i) {
+                const Point c(offsets[o] + checkRand(0, 4 * r), offsets[o] + checkRand(0, 4 * r));
+                if (i % 3 == 0)
+                    checkRectangle(c, checkRand(0.5, 4) * r, checkRand(0.5, 4) * r, checkRand(-M_PI, M_PI), C1s[i]);
+                else
+                    checkConvex(c, checkRand(0.5, 3) * r, checkRand(0.5, 3) * r, 3 + checkRandInt(8), C1s[i]);
+                checkConvex(c + Point(checkRand(-2, 2), checkRand(-2, 2)) * r,
+                            checkRand(0.5, 3) * r, checkRand(0.5, 3) * r, 3 + checkRandInt(8), C2s[i]);
+                if (i % 2)
+                    std::reverse(C2s[i].begin(), C2s[i].end());
+                nFailed += !S1.push_back(C1s[i]) || !S2.push_back(C2s[i]);
+                ++nChecked;
+            }
+
+            // Round trip: every vertex within maxError(), in anticlockwise.
+            for (int i = 0; i < 40; ++i) {
+                Vertexes D;
+                S2.decode(i, D);
+                Vertexes C = C2s[i];
+                if (i % 2)
+                    std::reverse(C.begin(), C.end());
+                double err = D.size() == C.size() ? 0.0 : 1e300;
+                for (int k = 0; k < (int)D.size() && k < (int)C.size(); ++k)
+                    err = std::max(err, std::max(abs(D[k].x - C[k].x), abs(D[k].y - C[k].y)));
+                nFailed += !(D.size() == C.size() && err <= S2.maxError(i) * (1.0 + 1e-6) &&
+                             S2.maxError(i) <= 1e-4 * r);
+                ++nChecked;
+            }
+
+            // Against the clipper on the decoded polygons, and within the
+            // quantization error of the ones given.
+            std::vector<double> ious;
+            iouCompactBatch(S1, S2, ious);
+            for (int i = 0; i < 40; ++i) {
+                Vertexes D1;
+                S1.decode(i, D1);
+                for (int j = 0; j < 40; ++j) {
+                    Vertexes D2;
+                    S2.decode(j, D2);
+                    const double v = ious[i * 40 + j];
+                    const double a1 = areaEx(C1s[i]);
+                    const double a2 = areaEx(C2s[j]);
+                    const double ref = iouClip(C1s[i], C2s[j]);
+                    const double inter = ref * (a1 + a2) / (1.0 + ref);
+                    const double tol = 4.0 * (perimeter(C1s[i]) * S1.maxError(i) +
+                                              perimeter(C2s[j]) * S2.maxError(j)) / (a1 + a2 - inter);
+                    nFailed += !(abs(v - iouClip(D1, D2)) < 1e-9 && abs(v - ref) <= tol &&
+                                 v == iouCompact(S1, i, S2, j));
+                    nFailed += !(abs(areaIntersectionCompact(S1, i, S2, j) - areaIntersectionClip(D1, D2)) <=
+                                 1e-9 * std::max(a1, a2));
+                    nChecked += 2;
+                }
+            }
+
+            // The pairs give the same as the batch.
+            std::vector<std::pair<int, int> > pairs;
+            for (int k = 0; k < 200; ++k)
+                pairs.push_back(std::make_pair(checkRandInt(40), checkRandInt(40)));
+            std::vector<double> pairIous;
+            iouCompactPairs(S1, S2, pairs, pairIous);
+            int nBad = 0;
+            for (int k = 0; k < (int)pairs.size(); ++k)
+                nBad += pairIous[k] != ious[pairs[k].first * 40 + pairs[k].second];
+            nFailed += nBad > 0;
+            ++nChecked;
+        }
+    }
+
+    // Non-convex polygons are kept with no vertexes and give -1.0,
+    // and a set of quads takes about 36 bytes each.
+    CompactPolygonSet S;
+    Vertexes Q;
+    checkRectangle(Point(1, 1), 2, 1, 0.3, Q);
+    S.reserve(1001, 4004);
+    for (int i = 0; i < 1000; ++i)
+        S.push_back(Q);
+    std::swap(Q[0], Q[1]);
+    nFailed += S.push_back(Q);
+    nFailed += !(S.vertexCount(1000) == 0 && iouCompact(S, 1000, S, 0) == -1.0 &&
+                 areaIntersectionCompact(S, 0, S, 1000) == -1.0 && abs(iouCompact(S, 0, S, 1) - 1.0) < 1e-12);
+    nFailed += !(S.memoryBytes() <= 1001 * 36 + 64);
+    nChecked += 3;
+
+    return checkReport("compact", nFailed, nChecked);
+}
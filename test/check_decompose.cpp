@@ -0,0 +1,168 @@
+/***********************************
+ * check_decompose.cpp
+ *
+ * Checks of iou_decompose.h.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "check.h"
+#include "../src/iou_clip.h"
+#include "../src/iou_decompose.h"
+
+#include <algorithm>
+
+// Even-odd rule, for any simple polygon.
+static bool insideSimple(const Vertexes &C, const Point &p)
+{
+    bool bIn = false;
+    const int N = C.size();
+    for (int i = 0, j = N - 1; i < N; j = i++) {
+        if ((C[i].y > p.y) != (C[j].y > p.y) &&
+            p.x < C[j].x + (C[i].x - C[j].x) * (p.y - C[j].y) / (C[i].y - C[j].y))
+            bIn = !bIn;
+    }
+    return bIn;
+}
+
+// An L of area 6, a comb of n teeth of area 2.5 n, and a star of n points,
+// in anticlockwise.
+static void shapeL(Vertexes &C)
+{
+    const Point P[6] = { Point(0, 0), Point(4, 0), Point(4, 1), Point(1, 1), Point(1, 3), Point(0, 3) };
+    C.assign(P, P + 6);
+}
+static void shapeComb(const int n, Vertexes &C)
+{
+    C.clear();
+    C.push_back(Point(0, 0));
+    C.push_back(Point(n, 0));
+    C.push_back(Point(n, 1));
+    for (int k = n - 1; k >= 0; --k) {
+        C.push_back(Point(k + 0.5, 1.0));
+        C.push_back(Point(k + 0.5, 4.0));
+        C.push_back(Point(k, 4.0));
+        if (k > 0)
+            C.push_back(Point(k, 1.0));
+    }
+}
+static void shapeStar(const int n, const double r0, const double r1, Vertexes &C)
+{
+    C.clear();
+    for (int k = 0; k < 2 * n; ++k) {
+        const double t = M_PI * k / n;
+        const double r = k % 2 ? r1 : r0;
+        C.push_back(Point(r * cos(t), r * sin(t)));
+    }
+}
+// Scaled by s, turned by t, moved by d, and in either wise.
+static void placed(const Vertexes &C, const double s, const double t, const Point &d, Vertexes &D)
+{
+    D.resize(C.size());
+    for (int k = 0; k < (int)C.size(); ++k)
+        D[k] = Point(s * (cos(t) * C[k].x - sin(t) * C[k].y), s * (sin(t) * C[k].x + cos(t) * C[k].y)) + d;
+    if (checkRandInt(2))
+        std::reverse(D.begin(), D.end());
+}
+static double signedArea(const Vertexes &C)
+{
+    double s2 = 0.0;
+    for (int k = 0; k < (int)C.size(); ++k)
+        s2 += C[k] ^ C[(k + 1) % C.size()];
+    return s2 * 0.5;
+}
+
+bool checkDecompose()
+{
+    int nFailed = 0;
+    int nChecked = 0;
+
+    std::vector<Vertexes> shapes(5);
+    shapeL(shapes[0]);
+    shapeComb(3, shapes[1]);
+    shapeComb(6, shapes[2]);
+    shapeStar(5, 3.0, 1.2, shapes[3]);
+    shapeStar(9, 2.5, 0.6, shapes[4]);
+    nFailed += !(signedArea(shapes[0]) == 6.0 && signedArea(shapes[1]) == 7.5 && signedArea(shapes[2]) == 15.0);
+    ++nChecked;
+
+    // The pieces are convex, in anticlockwise, and make up the polygon.
+    for (int k = 0; k < (int)shapes.size(); ++k) {
+        Vertexes C;
+        placed(shapes[k], checkRand(0.5, 2), checkRand(-M_PI, M_PI), Point(checkRand(-5, 5), checkRand(-5, 5)), C);
+        const DecomposedPolygon P(C);
+        double sPieces = 0.0;
+        bool bConvex = true;
+        for (int i = 0; i < P.pieceCount(); ++i) {
+            bConvex = bConvex && whichWiseEx(P.piece(i)) == AntiClockWise;
+            sPieces += signedArea(P.piece(i));
+        }
+        nFailed += !(P.isValid() && P.pieceCount() > 1 && bConvex &&
+                     abs(P.area() - abs(signedArea(C))) < 1e-9 * P.area() &&
+                     abs(sPieces - P.area()) < 1e-9 * P.area());
+        ++nChecked;
+    }
+
+    // Pairs of L, comb, star and convex polygons against sampling.
+    for (int t = 0; t < 60; ++t) {
+        Vertexes C1, C2;
+        placed(shapes[t % shapes.size()], checkRand(0.8, 1.5), checkRand(-M_PI, M_PI), Point(0, 0), C1);
+        if (t % 4 == 3)
+            checkConvex(Point(checkRand(-2, 2), checkRand(-2, 2)), checkRand(1, 3), checkRand(1, 3), 3 + checkRandInt(6), C2);
+        else
+            placed(shapes[(t / 2) % shapes.size()], checkRand(0.8, 1.5), checkRand(-M_PI, M_PI),
+                   Point(checkRand(-2, 2), checkRand(-2, 2)), C2);
+
+        double x0 = C1[0].x, x1 = x0, y0 = C1[0].y, y1 = y0;
+        for (int s = 0; s < 2; ++s) {
+            const Vertexes &C = s == 0 ? C1 : C2;
+            for (int k = 0; k < (int)C.size(); ++k) {
+                x0 = std::min(x0, C[k].x);
+                x1 = std::max(x1, C[k].x);
+                y0 = std::min(y0, C[k].y);
+                y1 = std::max(y1, C[k].y);
+            }
+        }
+        const double inter = checkSampledArea([&](const Point &p) {
+            return insideSimple(C1, p) && insideSimple(C2, p); }, x0, y0, x1, y1, 600);
+        const double a1 = abs(signedArea(C1));
+        const double a2 = abs(signedArea(C2));
+        const double tol = 0.003 * (a1 + a2);
+        const DecomposedPolygon P1(C1), P2(C2);
+        nFailed += !(abs(areaIntersectionSimple(P1, P2) - inter) < tol);
+        nFailed += !(abs(areaUnionSimple(P1, P2) - (a1 + a2 - inter)) < tol);
+        nFailed += !(abs(iouSimple(C1, C2) - inter / (a1 + a2 - inter)) < 0.01);
+        nChecked += 3;
+    }
+
+    // Convex polygons give the same as the clipper, self-intersecting ones -1.0.
+    Vertexes Q1, Q2;
+    checkConvex(Point(0, 0), 2, 1, 7, Q1);
+    checkRectangle(Point(0.5, 0.5), 3, 1, 0.4, Q2);
+    nFailed += !(abs(iouSimple(Q1, Q2) - iouClip(Q1, Q2)) < 1e-12);
+    Vertexes bowtie = Q2;
+    std::swap(bowtie[0], bowtie[1]);
+    nFailed += !(iouSimple(bowtie, Q1) == -1.0 && !DecomposedPolygon(bowtie).isValid());
+    nChecked += 2;
+
+    // The batch matches the pairs.
+    std::vector<DecomposedPolygon> P1s, P2s;
+    for (int k = 0; k < 10; ++k) {
+        Vertexes C;
+        placed(shapes[k % shapes.size()], 1.0, checkRand(-M_PI, M_PI), Point(checkRand(-2, 2), checkRand(-2, 2)), C);
+        (k % 2 ? P1s : P2s).push_back(DecomposedPolygon(C));
+    }
+    std::vector<double> ious;
+    iouSimpleBatch(P1s, P2s, ious);
+    int nBad = 0;
+    for (int i = 0; i < (int)P1s.size(); ++i) {
+        for (int j = 0; j < (int)P2s.size(); ++j)
+            nBad += ious[i * P2s.size() + j] != iouSimple(P1s[i], P2s[j]);
+    }
+    nFailed += nBad > 0;
+    ++nChecked;
+
+    return checkReport("decompose", nFailed, nChecked);
+}
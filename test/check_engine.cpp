@@ -0,0 +1,145 @@
+/***********************************
+ * check_engine.cpp
+ *
+ * Checks of iou_engine.h.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "check.h"
+#include "../src/iou_clip.h"
+#include "../src/iou_engine.h"
+
+#include <algorithm>
+#include <climits>
+
+// Polygon of the given kind around c, in either wise.
+static void randomShape(const ShapeKind kind, const Point &c, Vertexes &C)
+{
+    switch (kind) {
+    case ShapeAxisBox: {
+        const double w = checkRand(0.5, 4), h = checkRand(0.5, 4);
+        C.clear();
+        C.push_back(c + Point(-w, -h));
+        C.push_back(c + Point(w, -h));
+        C.push_back(c + Point(w, h));
+        C.push_back(c + Point(-w, h));
+        break;
+    }
+    case ShapeRectangle:
+        checkRectangle(c, checkRand(0.5, 4), checkRand(0.5, 4), checkRand(0.1, 1.4), C);
+        break;
+    case ShapeQuad:
+        checkConvex(c, checkRand(0.5, 3), checkRand(0.5, 3), 4, C);
+        break;
+    case ShapePolygon:
+        checkConvex(c, checkRand(0.5, 3), checkRand(0.5, 3), checkRandInt(2) ? 3 : 5 + checkRandInt(6), C);
+        break;
+    default:
+        checkRectangle(c, 2.0, 1.0, checkRand(-M_PI, M_PI), C);
+        std::swap(C[0], C[1]);
+        break;
+    }
+    if (checkRandInt(2))
+        std::reverse(C.begin(), C.end());
+}
+
+static bool isQuad(const ShapeKind kind)
+{
+    return kind == ShapeAxisBox || kind == ShapeRectangle || kind == ShapeQuad;
+}
+// The engine each pair of kinds is expected to take.
+static Engine expectedEngine(const ShapeKind k1, const ShapeKind k2, const bool bSimd)
+{
+    if (k1 == ShapeNonConvex || k2 == ShapeNonConvex)
+        return EngineNone;
+    if (k1 == ShapeAxisBox && k2 == ShapeAxisBox)
+        return EngineAxisBox;
+    if (bSimd && isQuad(k1) && isQuad(k2))
+        return EngineQuadSimd;
+    if (k1 == ShapeAxisBox || k1 == ShapeRectangle || k2 == ShapeAxisBox || k2 == ShapeRectangle)
+        return EngineRectClip;
+    return EngineConvexClip;
+}
+
+bool checkEngine()
+{
+    int nFailed = 0;
+    int nChecked = 0;
+
+    // Every kind is recognized, and every pair of kinds takes its engine.
+    const int nKinds = 5;
+    const ShapeKind kinds[nKinds] = { ShapeNonConvex, ShapeAxisBox, ShapeRectangle, ShapeQuad, ShapePolygon };
+    for (int k = 0; k < nKinds; ++k) {
+        Vertexes C;
+        randomShape(kinds[k], Point(5, 5), C);
+        nFailed += shapeKind(C) != kinds[k];
+        ++nChecked;
+        for (int l = 0; l < nKinds; ++l) {
+            nFailed += dispatchEngine(kinds[k], kinds[l], 0) != expectedEngine(kinds[k], kinds[l], false);
+            nFailed += dispatchEngine(kinds[k], kinds[l], INT_MAX) != expectedEngine(kinds[k], kinds[l], true);
+            nChecked += 2;
+        }
+    }
+
+    // Every pair of kinds against the clipper, one pair at a time.
+    std::vector<Vertexes> C1s, C2s;
+    for (int i = 0; i < 300; ++i) {
+        const Point c(checkRand(0, 6), checkRand(0, 6));
+        Vertexes C1, C2;
+        randomShape(kinds[i % nKinds], c, C1);
+        randomShape(kinds[(i / nKinds) % nKinds], c + Point(checkRand(-3, 3), checkRand(-3, 3)), C2);
+        C1s.push_back(C1);
+        C2s.push_back(C2);
+    }
+    for (int i = 0; i < (int)C1s.size(); ++i) {
+        for (int j = 0; j < (int)C2s.size(); j += 7) {
+            const double ref = iouClip(C1s[i], C2s[j]);
+            const double v = iouAuto(C1s[i], C2s[j]);
+            const double a = areaIntersectionAuto(C1s[i], C2s[j]);
+            nFailed += ref < 0.0 ? v != -1.0 || a != -1.0
+                                 : !(abs(v - ref) < 1e-9 &&
+                                     abs(a - areaIntersectionClip(C1s[i], C2s[j])) < 1e-9);
+            ++nChecked;
+        }
+    }
+
+    // Batches, with the SIMD kernel forced off and on.
+    const DispatchPlan plan0 = dispatchPlan();
+    for (int s = 0; s < 2; ++s) {
+        DispatchPlan plan = plan0;
+        plan.simdMinPairs = plan.simdMinRectPairs = s == 0 ? INT_MAX : 1;
+        setDispatchPlan(plan);
+        const double tol = s == 0 ? 1e-12 : 1e-4;
+
+        std::vector<double> ious;
+        iouAutoBatch(C1s, C2s, ious);
+        int nBad = 0;
+        for (int i = 0; i < (int)C1s.size(); ++i) {
+            for (int j = 0; j < (int)C2s.size(); ++j)
+                nBad += !(abs(ious[(size_t)i * C2s.size() + j] - iouAuto(C1s[i], C2s[j])) <= tol);
+        }
+        nFailed += nBad > 0;
+        ++nChecked;
+
+        std::vector<const Vertexes *> p1s, p2s;
+        for (int i = 0; i < (int)C1s.size(); ++i) {
+            p1s.push_back(&C1s[i]);
+            p2s.push_back(&C2s[i]);
+        }
+        std::vector<std::pair<int, int> > pairs;
+        for (int k = 0; k < 5000; ++k)
+            pairs.push_back(std::make_pair(checkRandInt(C1s.size()), checkRandInt(C2s.size())));
+        iouAutoPairs(p1s, p2s, pairs, ious);
+        nBad = 0;
+        for (int k = 0; k < (int)pairs.size(); ++k)
+            nBad += !(abs(ious[k] - iouAuto(C1s[pairs[k].first], C2s[pairs[k].second])) <= tol);
+        nFailed += nBad > 0;
+        ++nChecked;
+    }
+    setDispatchPlan(plan0);
+
+    return checkReport("engine", nFailed, nChecked);
+}
@@ -0,0 +1,157 @@
+/***********************************
+ * check_gjk.cpp
+ *
+ * Checks of iou_gjk.h.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "check.h"
+#include "../src/iou_clip.h"
+#include "../src/iou_gjk.h"
+
+#include <algorithm>
+
+static double segmentDistance(const Point &p, const Point &a, const Point &b)
+{
+    const Point ab = b - a;
+    const double t = std::max(0.0, std::min(1.0, ((p - a) * ab) / ab.normSquared()));
+    return p.distance(a + ab * t);
+}
+// Distance from the vertexes to the edges, 0 on overlap.
+static double bruteDistance(const Vertexes &C1, const Vertexes &C2)
+{
+    if (areaIntersectionClip(C1, C2) > 0.0 || checkInside(C1, C2[0]) || checkInside(C2, C1[0]))
+        return 0.0;
+    double d = 1e300;
+    for (int s = 0; s < 2; ++s) {
+        const Vertexes &A = s == 0 ? C1 : C2;
+        const Vertexes &B = s == 0 ? C2 : C1;
+        for (int i = 0; i < (int)A.size(); ++i) {
+            for (int j = 0; j < (int)B.size(); ++j)
+                d = std::min(d, segmentDistance(A[i], B[j], B[(j + 1) % B.size()]));
+        }
+    }
+    return d;
+}
+// Smallest overlap of the projections over the edge normals of both.
+static double bruteDepth(const Vertexes &C1, const Vertexes &C2)
+{
+    double depth = 1e300;
+    for (int s = 0; s < 2; ++s) {
+        const Vertexes &A = s == 0 ? C1 : C2;
+        for (int i = 0; i < (int)A.size(); ++i) {
+            const Point e = A[(i + 1) % A.size()] - A[i];
+            const Point n = Point(-e.y, e.x).normalized();
+            double lo1 = 1e300, hi1 = -1e300, lo2 = 1e300, hi2 = -1e300;
+            for (int k = 0; k < (int)C1.size(); ++k) {
+                lo1 = std::min(lo1, n * C1[k]);
+                hi1 = std::max(hi1, n * C1[k]);
+            }
+            for (int k = 0; k < (int)C2.size(); ++k) {
+                lo2 = std::min(lo2, n * C2[k]);
+                hi2 = std::max(hi2, n * C2[k]);
+            }
+            depth = std::min(depth, std::max(0.0, std::min(hi1 - lo2, hi2 - lo1)));
+        }
+    }
+    return depth;
+}
+static void moved(const Vertexes &C, const Point &d, Vertexes &D)
+{
+    D = C;
+    for (int k = 0; k < (int)D.size(); ++k)
+        D[k] += d;
+}
+
+bool checkGjk()
+{
+    int nFailed = 0;
+    int nChecked = 0;
+
+    std::vector<Vertexes> Cs(300);
+    for (int i = 0; i < (int)Cs.size(); ++i) {
+        if (i % 3 == 0)
+            checkRectangle(Point(checkRand(0, 12), checkRand(0, 12)),
+                           checkRand(0.5, 4), checkRand(0.5, 4), checkRand(-M_PI, M_PI), Cs[i]);
+        else
+            checkConvex(Point(checkRand(0, 12), checkRand(0, 12)),
+                        checkRand(0.5, 3), checkRand(0.5, 3), 3 + checkRandInt(8), Cs[i]);
+        if (i % 2)
+            std::reverse(Cs[i].begin(), Cs[i].end());
+    }
+
+    int nOverlap = 0;
+    int nApart = 0;
+    for (int k = 0; k + 1 < (int)Cs.size(); k += 2) {
+        for (int l = 0; l < 20; ++l) {
+            const Vertexes &C1 = Cs[k];
+            const Vertexes &C2 = Cs[(k + 1 + 7 * l) % Cs.size()];
+            const double ref = bruteDistance(C1, C2);
+            nFailed += !(abs(distanceEx(C1, C2) - ref) < 1e-6);
+            // Gated: exact below the gate, a bound above it otherwise.
+            const double gated = distanceEx(C1, C2, 1.0);
+            nFailed += !(ref <= 1.0 ? abs(gated - ref) < 1e-6 : gated > 1.0 && gated <= ref + 1e-6);
+            nChecked += 2;
+            if (ref > 0.0) {
+                ++nApart;
+                nFailed += !(penetrationDepthEx(C1, C2) == 0.0 &&
+                             abs(signedDistanceEx(C1, C2) - ref) < 1e-6);
+                ++nChecked;
+                continue;
+            }
+
+            // Moving C2 by the depth along the normal separates them, and
+            // moving it a little less does not.
+            ++nOverlap;
+            Point n;
+            const double depth = penetrationDepthEx(C1, C2, &n);
+            nFailed += !(abs(depth - bruteDepth(C1, C2)) < 1e-6 && abs(n.norm() - 1.0) < 1e-9);
+            nFailed += !(abs(signedDistanceEx(C1, C2) + depth) < 1e-9);
+            Vertexes D;
+            moved(C2, n * (depth + 1e-6), D);
+            nFailed += !(areaIntersectionClip(C1, D) < 1e-6);
+            moved(C2, n * (depth * 0.99), D);
+            nFailed += !(depth < 1e-6 || areaIntersectionClip(C1, D) > 0.0);
+            nChecked += 4;
+        }
+    }
+    nFailed += nOverlap == 0 || nApart == 0;
+    ++nChecked;
+
+    // Quads give the same as polygons, non-convex ones -1.0.
+    const Quad Q1(Cs[0][0], Cs[0][1], Cs[0][2], Cs[0][3]);
+    const Quad Q2(Cs[3][0], Cs[3][1], Cs[3][2], Cs[3][3]);
+    nFailed += !(distance(Q1, Q2) == distanceEx(Cs[0], Cs[3]) &&
+                 penetrationDepth(Q1, Q2) == penetrationDepthEx(Cs[0], Cs[3]) &&
+                 signedDistance(Q1, Q2) == signedDistanceEx(Cs[0], Cs[3]));
+    nFailed += !(distance(Quad(Q1.p2, Q1.p1, Q1.p3, Q1.p4), Q2) == -1.0);
+    nChecked += 2;
+
+    // Gated batch against the pair by pair answers.
+    std::vector<Vertexes> C1s(Cs.begin(), Cs.begin() + 100);
+    std::vector<Vertexes> C2s(Cs.begin() + 100, Cs.end());
+    std::swap(C2s[5][0], C2s[5][1]);
+    std::vector<double> ious, dists;
+    iouGateBatch(C1s, C2s, 0.5, ious, dists);
+    int nBad = 0;
+    for (int i = 0; i < (int)C1s.size(); ++i) {
+        for (int j = 0; j < (int)C2s.size(); ++j) {
+            const double v = ious[(size_t)i * C2s.size() + j];
+            const double d = dists[(size_t)i * C2s.size() + j];
+            if (j == 5) {
+                nBad += v != -1.0 || d != -1.0;
+                continue;
+            }
+            const double ref = bruteDistance(C1s[i], C2s[j]);
+            nBad += ref <= 0.5 ? abs(d - ref) > 1e-6 : !(d > 0.5);
+            nBad += abs(v - (ref > 0.0 ? 0.0 : iouClip(C1s[i], C2s[j]))) > 1e-9;
+        }
+    }
+    nFailed += nBad > 0;
+    ++nChecked;
+
+    return checkReport("gjk", nFailed, nChecked);
+}
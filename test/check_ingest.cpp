@@ -0,0 +1,155 @@
+/***********************************
+ * check_ingest.cpp
+ *
+ * Checks of iou_ingest.h.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "check.h"
+#include "../src/iou_ingest.h"
+
+#include <algorithm>
+
+// Same vertexes in the same cyclic order.
+static bool sameCycle(const Vertexes &A, const Vertexes &B)
+{
+    const int N = A.size();
+    if (N != (int)B.size())
+        return false;
+    for (int s = 0; s < N; ++s) {
+        bool bSame = true;
+        for (int k = 0; k < N && bSame; ++k)
+            bSame = A[k] == B[(k + s) % N];
+        if (bSame)
+            return true;
+    }
+    return N == 0;
+}
+static Vertexes reversed(const Vertexes &C)
+{
+    return Vertexes(C.rbegin(), C.rend());
+}
+
+bool checkIngest()
+{
+    int nFailed = 0;
+    int nChecked = 0;
+
+    std::vector<Vertexes> Cs;
+    std::vector<int> expected;
+    for (int i = 0; i < 200; ++i) {
+        Vertexes C;
+        checkConvex(Point(checkRand(0, 10), checkRand(0, 10)), checkRand(0.5, 3), checkRand(0.5, 3),
+                    3 + checkRandInt(8), C);
+        if (whichWiseEx(C) != AntiClockWise)
+            continue;
+        const Vertexes C0 = C;
+
+        // Winding: kept, or reversed from the signed area.
+        const bool bClockWise = i % 2;
+        if (bClockWise)
+            std::reverse(C.begin(), C.end());
+        int flags = bClockWise ? IngestReversed : 0;
+        // Repeated vertexes, also across the end.
+        if (i % 3 == 0) {
+            C.insert(C.begin() + 1, C[1]);
+            C.push_back(C[0]);
+            flags |= IngestDeduplicated;
+        }
+        // Vertexes in the middle of edges.
+        if (i % 5 == 0) {
+            const Point m = (C[0] + C[1]) * 0.5;
+            C.insert(C.begin() + 1, m);
+            C.push_back((C.back() + C[0]) * 0.5);
+            flags |= IngestStraightened;
+        }
+
+        Vertexes D = C;
+        nFailed += ingestPolygon(D) != flags;
+        nFailed += !(sameCycle(D, C0) && whichWiseEx(D) == AntiClockWise);
+        D = C;
+        ingestPolygon(D, false, ClockWise);
+        nFailed += !(sameCycle(D, reversed(C0)) && whichWiseEx(D) == ClockWise);
+        nChecked += 3;
+        Cs.push_back(C);
+        expected.push_back(flags);
+    }
+
+    // Non-convex polygons: invalid and left in their wise, or replaced by their hull.
+    const Point L[6] = { Point(0, 0), Point(4, 0), Point(4, 1), Point(1, 1), Point(1, 3), Point(0, 3) };
+    const Point hullL[5] = { Point(0, 0), Point(4, 0), Point(4, 1), Point(1, 3), Point(0, 3) };
+    for (int s = 0; s < 2; ++s) {
+        Vertexes C(L, L + 6);
+        if (s)
+            std::reverse(C.begin(), C.end());
+        Vertexes D = C;
+        nFailed += ingestPolygon(D) != IngestInvalid || !sameCycle(D, C);
+        D = C;
+        nFailed += ingestPolygon(D, true) != (IngestRepaired | (s ? IngestReversed : 0));
+        nFailed += !sameCycle(D, Vertexes(hullL, hullL + 5)) || whichWiseEx(D) != AntiClockWise;
+        nChecked += 3;
+        Cs.push_back(C);
+        expected.push_back(IngestInvalid);
+    }
+    Vertexes bowtie;
+    checkRectangle(Point(2, 2), 3, 1, 0.7, bowtie);
+    const Vertexes box = bowtie;
+    std::swap(bowtie[1], bowtie[2]);
+    Vertexes D = bowtie;
+    nFailed += !(ingestPolygon(D, true) & IngestRepaired) || !sameCycle(D, box);
+    ++nChecked;
+
+    // Nothing to keep: too few vertexes, or no area.
+    std::vector<Vertexes> bad(3);
+    bad[0].push_back(Point(1, 1));
+    bad[0].push_back(Point(2, 1));
+    for (int k = 0; k < 4; ++k) {
+        bad[1].push_back(Point(1, 1) + Point(1, 2) * k);
+        bad[2].push_back(Point(3, 3));
+    }
+    for (int k = 0; k < (int)bad.size(); ++k) {
+        D = bad[k];
+        nFailed += !(ingestPolygon(D, true) & IngestInvalid);
+        ++nChecked;
+        Cs.push_back(bad[k]);
+        expected.push_back(ingestPolygon(bad[k]));
+    }
+
+    // The batch gives the same flags, and counts them.
+    IngestReport report;
+    ingestPolygons(Cs, report);
+    int nBad = report.flags != expected;
+    int nValid = 0;
+    int nReversed = 0;
+    int nCleaned = 0;
+    for (int i = 0; i < (int)expected.size(); ++i) {
+        nValid += (expected[i] & IngestInvalid) == 0;
+        nReversed += (expected[i] & IngestReversed) != 0;
+        nCleaned += (expected[i] & (IngestDeduplicated | IngestStraightened)) != 0;
+        nBad += report.isValid(i) != ((expected[i] & IngestInvalid) == 0);
+    }
+    nBad += report.nValid != nValid || report.nInvalid != (int)expected.size() - nValid ||
+            report.nReversed != nReversed || report.nCleaned != nCleaned || report.nRepaired != 0;
+    nFailed += nBad > 0;
+    ++nChecked;
+
+    // The hull holds every point and is strictly convex.
+    for (int t = 0; t < 50; ++t) {
+        Vertexes pts, hull;
+        for (int k = 0; k < 5 + checkRandInt(40); ++k)
+            pts.push_back(Point(checkRandInt(20), checkRand(0, 10)));
+        convexHullEx(pts, hull);
+        bool bHolds = whichWiseEx(hull) == AntiClockWise;
+        for (int k = 0; k < (int)pts.size() && bHolds; ++k)
+            bHolds = checkInside(hull, pts[k]);
+        for (int k = 0; k < (int)hull.size() && bHolds; ++k)
+            bHolds = std::find(pts.begin(), pts.end(), hull[k]) != pts.end();
+        nFailed += !bHolds;
+        ++nChecked;
+    }
+
+    return checkReport("ingest", nFailed, nChecked);
+}
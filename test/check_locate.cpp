@@ -0,0 +1,119 @@
+/***********************************
+ * check_locate.cpp
+ *
+ * Checks of iou_locate.h.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "check.h"
+#include "../src/iou_locate.h"
+
+#include <algorithm>
+
+// Inner, outer, edge and vertex points of C, and points just off its edges.
+static void probePoints(const Vertexes &C, std::vector<Point> &pts)
+{
+    const int N = C.size();
+    double x0 = C[0].x, x1 = C[0].x, y0 = C[0].y, y1 = C[0].y;
+    for (int k = 0; k < N; ++k) {
+        x0 = std::min(x0, C[k].x);
+        x1 = std::max(x1, C[k].x);
+        y0 = std::min(y0, C[k].y);
+        y1 = std::max(y1, C[k].y);
+    }
+    pts.clear();
+    for (int k = 0; k < 200; ++k)
+        pts.push_back(Point(checkRand(x0 - 1.0, x1 + 1.0), checkRand(y0 - 1.0, y1 + 1.0)));
+    for (int k = 0; k < N; ++k) {
+        const Point &a = C[k];
+        const Point &b = C[(k + 1) % N];
+        const Point n = Point(a.y - b.y, b.x - a.x).normalized();
+        pts.push_back(a);
+        for (int s = 0; s < 4; ++s) {
+            const Point p = a + (b - a) * checkRand(0.0, 1.0);
+            pts.push_back(p);
+            pts.push_back(p + n * 1e-9);
+            pts.push_back(p - n * 1e-9);
+            pts.push_back(p + n * 1e-4);
+            pts.push_back(p - n * 1e-4);
+        }
+        // Along the edge line, beyond the vertexes.
+        pts.push_back(a + (a - b) * 0.1);
+        pts.push_back(b + (b - a) * 0.1);
+    }
+}
+
+bool checkLocate()
+{
+    int nFailed = 0;
+    int nChecked = 0;
+
+    std::vector<Vertexes> Cs;
+    for (int k = 0; k < 200; ++k) {
+        Vertexes C;
+        checkConvex(Point(checkRand(-10, 10), checkRand(-10, 10)),
+                    checkRand(0.5, 5.0), checkRand(0.5, 5.0), 3 + checkRandInt(10), C);
+        if (k % 4 == 1)
+            std::reverse(C.begin(), C.end());
+        if (k % 4 == 2) {
+            // Collinear vertexes in the middle of edges.
+            const int N = C.size();
+            Vertexes D;
+            for (int i = 0; i < N; ++i) {
+                D.push_back(C[i]);
+                if (i % 2 == 0)
+                    D.push_back((C[i] + C[(i + 1) % N]) * 0.5);
+            }
+            C.swap(D);
+        }
+        if (k % 4 == 3)
+            checkRectangle(Point(checkRand(-10, 10), checkRand(-10, 10)),
+                           checkRand(0.5, 5.0), checkRand(0.5, 5.0), k % 8 == 3 ? 0.0 : checkRand(-M_PI, M_PI), C);
+        Cs.push_back(C);
+    }
+    // Triangles and a non-convex quad.
+    Vertexes T;
+    T.push_back(Point(0, 0));
+    T.push_back(Point(1, 0));
+    T.push_back(Point(0, 1));
+    Cs.push_back(T);
+    T.push_back(Point(0.2, 0.2));
+    Cs.push_back(T);
+
+    int nCount[3] = {0, 0, 0};
+    std::vector<Point> pts;
+    for (int c = 0; c < (int)Cs.size(); ++c) {
+        const Vertexes &C = Cs[c];
+        const ConvexLocator locator(C);
+        nFailed += locator.isConvex() != (whichWiseEx(C) != NoneWise);
+        ++nChecked;
+        probePoints(C, pts);
+        std::vector<LocPosition> locs;
+        locationBatch(C, pts, locs);
+        for (int i = 0; i < (int)pts.size(); ++i) {
+            const LocPosition ref = locationEx(C, pts[i]);
+            nFailed += locator.location(pts[i]) != ref || locs[i] != ref;
+            ++nCount[ref];
+            ++nChecked;
+        }
+    }
+    // Every kind of answer was met.
+    nFailed += nCount[Inside] == 0 || nCount[OnEdge] == 0 || nCount[Outside] == 0;
+    ++nChecked;
+
+    // Many polygons at once.
+    std::vector<LocPosition> locs;
+    locationBatch(Cs, pts, locs);
+    int nBad = 0;
+    for (int i = 0; i < (int)pts.size(); ++i) {
+        for (int c = 0; c < (int)Cs.size(); ++c)
+            nBad += locs[(size_t)i * Cs.size() + c] != locationEx(Cs[c], pts[i]);
+    }
+    nFailed += nBad > 0;
+    ++nChecked;
+
+    return checkReport("locate", nFailed, nChecked);
+}
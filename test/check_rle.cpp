@@ -0,0 +1,149 @@
+/***********************************
+ * check_rle.cpp
+ *
+ * Checks of iou_rle.h.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "check.h"
+#include "../src/iou_rle.h"
+
+#include <algorithm>
+
+// Pixels of an h x w image, row by row.
+typedef std::vector<char> Pixels;
+
+static void pixelsOfPolygon(const Vertexes &C, const int h, const int w, Pixels &P)
+{
+    P.assign(h * w, 0);
+    for (int i = 0; i < h; ++i) {
+        for (int j = 0; j < w; ++j)
+            P[i * w + j] = checkInside(C, Point(j, i));
+    }
+}
+// A few random blobs.
+static void randomPixels(const int h, const int w, Pixels &P)
+{
+    P.assign(h * w, 0);
+    for (int k = 0; k < 4; ++k) {
+        const double cx = checkRand(0, w), cy = checkRand(0, h);
+        const double r = checkRand(2, 0.4 * std::min(h, w));
+        for (int i = 0; i < h; ++i) {
+            for (int j = 0; j < w; ++j)
+                P[i * w + j] |= (j - cx) * (j - cx) + (i - cy) * (i - cy) < r * r;
+        }
+    }
+}
+static void rleOfPixels(const Pixels &P, const int h, const int w, const RleOrder order, RLE &R)
+{
+    R = RLE(h, w, std::vector<unsigned int>(), order);
+    char v = 0;
+    unsigned int n = 0;
+    for (int k = 0; k < h * w; ++k) {
+        const char p = order == RowMajor ? P[k] : P[(k % h) * w + k / h];
+        if (p != v) {
+            R.counts.push_back(n);
+            v = p;
+            n = 0;
+        }
+        ++n;
+    }
+    R.counts.push_back(n);
+}
+static void countPixels(const Pixels &A, const Pixels &B, int &nA, int &nB, int &nI)
+{
+    nA = nB = nI = 0;
+    for (int k = 0; k < (int)A.size(); ++k) {
+        nA += A[k];
+        nB += B[k];
+        nI += A[k] && B[k];
+    }
+}
+
+bool checkRle()
+{
+    int nFailed = 0;
+    int nChecked = 0;
+
+    // Polygons, partly out of the image, and masks in both orders against
+    // pixel counts.
+    for (int t = 0; t < 100; ++t) {
+        const int h = 10 + checkRandInt(50);
+        const int w = 10 + checkRandInt(50);
+        Vertexes C;
+        checkConvex(Point(checkRand(-5, w + 5), checkRand(-5, h + 5)), checkRand(2, 30), checkRand(2, 30),
+                    3 + checkRandInt(8), C);
+        if (t % 2)
+            std::reverse(C.begin(), C.end());
+        Pixels PC, PM;
+        pixelsOfPolygon(C, h, w, PC);
+        randomPixels(h, w, PM);
+        int nC, nM, nI;
+        countPixels(PC, PM, nC, nM, nI);
+        const double iou = nC + nM - nI > 0 ? (double)nI / (nC + nM - nI) : 0.0;
+
+        for (int o = 0; o < 2; ++o) {
+            const RleOrder order = o == 0 ? RowMajor : ColMajor;
+            RLE RC, RM;
+            rleOfPixels(PM, h, w, order, RM);
+            const bool bConvex = rleFromPolygon(C, h, w, RC, order);
+            nFailed += !(bConvex && areaRle(RC) == nC && areaRle(RM) == nM);
+            nFailed += !(areaIntersectionRle(C, RM) == nI && areaUnionRle(C, RM) == nC + nM - nI &&
+                         abs(iouRle(C, RM) - iou) < 1e-12);
+            nFailed += !(areaIntersectionRle(RC, RM) == nI && areaUnionRle(RC, RM) == nC + nM - nI &&
+                         abs(iouRle(RC, RM) - iou) < 1e-12);
+            nChecked += 3;
+        }
+    }
+
+    // Masks of other sizes or orders give -1.0, and so do non-convex
+    // polygons.
+    Vertexes C, bowtie;
+    checkRectangle(Point(10, 8), 12, 6, 0.4, C);
+    bowtie = C;
+    std::swap(bowtie[0], bowtie[1]);
+    RLE R, RCol, RWide, RBad;
+    rleFromPolygon(C, 20, 30, R);
+    rleFromPolygon(C, 20, 30, RCol, ColMajor);
+    rleFromPolygon(C, 20, 31, RWide);
+    nFailed += !(iouRle(R, RCol) == -1.0 && areaIntersectionRle(R, RWide) == -1.0 &&
+                 areaUnionRle(RWide, R) == -1.0 && abs(iouRle(R, R) - 1.0) < 1e-12);
+    nFailed += !(!rleFromPolygon(bowtie, 20, 30, RBad) && RBad.h == 0 && RBad.w == 0 &&
+                 areaRle(RBad) == 0.0 && iouRle(RBad, R) == -1.0 && iouRle(bowtie, R) == -1.0);
+    nChecked += 2;
+
+    // The batches match the pairs, with masks of other sizes among them.
+    std::vector<Vertexes> Cs(12);
+    std::vector<RLE> Rs(9);
+    for (int i = 0; i < (int)Cs.size(); ++i)
+        checkConvex(Point(checkRand(0, 40), checkRand(0, 30)), checkRand(2, 15), checkRand(2, 15),
+                    3 + checkRandInt(6), Cs[i]);
+    Cs[5] = bowtie;
+    for (int j = 0; j < (int)Rs.size(); ++j) {
+        const int h = j % 4 == 3 ? 25 : 30;
+        Pixels P;
+        randomPixels(h, 40, P);
+        rleOfPixels(P, h, 40, j % 3 == 2 ? ColMajor : RowMajor, Rs[j]);
+    }
+    std::vector<double> ious;
+    iouRleBatch(Cs, Rs, ious);
+    int nBad = 0;
+    for (int i = 0; i < (int)Cs.size(); ++i) {
+        for (int j = 0; j < (int)Rs.size(); ++j)
+            nBad += ious[i * Rs.size() + j] != iouRle(Cs[i], Rs[j]);
+    }
+    nFailed += nBad > 0;
+    iouRleBatch(Rs, Rs, ious);
+    nBad = 0;
+    for (int i = 0; i < (int)Rs.size(); ++i) {
+        for (int j = 0; j < (int)Rs.size(); ++j)
+            nBad += ious[i * Rs.size() + j] != iouRle(Rs[i], Rs[j]);
+    }
+    nFailed += nBad > 0;
+    nChecked += 2;
+
+    return checkReport("rle", nFailed, nChecked);
+}
@@ -0,0 +1,136 @@
+/***********************************
+ * check_service.cpp
+ *
+ * Checks of iou_service.h, and of the parallel scopes it runs in.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "check.h"
+#include "../src/iou_engine.h"
+#include "../src/iou_parallel.h"
+#include "../src/iou_service.h"
+
+#include <atomic>
+
+static void randomSet(const int n, std::vector<Vertexes> &Cs)
+{
+    Cs.resize(n);
+    for (int i = 0; i < n; ++i)
+        checkConvex(Point(checkRand(0, 6), checkRand(0, 6)), checkRand(0.5, 3), checkRand(0.5, 3),
+                    3 + checkRandInt(6), Cs[i]);
+}
+// The result of a request of C1s x C2s, against iouAuto().
+static bool isResultOf(const IouResult &result, const std::vector<Vertexes> &C1s,
+                       const std::vector<Vertexes> &C2s)
+{
+    if (result.error || result.ious.size() != C1s.size() * C2s.size())
+        return false;
+    for (int i = 0; i < (int)C1s.size(); ++i) {
+        for (int j = 0; j < (int)C2s.size(); ++j) {
+            if (abs(result.ious[i * C2s.size() + j] - iouAuto(C1s[i], C2s[j])) > 1e-4)
+                return false;
+        }
+    }
+    return true;
+}
+
+bool checkService()
+{
+    int nFailed = 0;
+    int nChecked = 0;
+
+    // Nested blocks run inline, and a scope restores the state it found.
+    {
+        const int nThreads0 = numThreads();
+        setNumThreads(4);
+        nFailed += detail::ParallelScope::inside();
+        std::atomic<int> nNested(0);
+        parallelFor(64, [&](int, int) {
+            nNested += !detail::ParallelScope::inside();
+            parallelFor(64, [&](int b2, int e2) {
+                nNested += b2 != 0 || e2 != 64;
+            });
+        }, 1);
+        nFailed += nNested != 0;
+        setNumThreads(nThreads0);
+        {
+            detail::ParallelScope scope;
+            nFailed += !detail::ParallelScope::inside();
+            {
+                detail::ParallelScope outside(false);
+                nFailed += detail::ParallelScope::inside();
+            }
+            nFailed += !detail::ParallelScope::inside();
+        }
+        nFailed += detail::ParallelScope::inside();
+        nChecked += 6;
+    }
+
+    std::vector<Vertexes> C1s, C2s;
+    randomSet(12, C1s);
+    randomSet(9, C2s);
+
+    // Requests queued together within the delay are run as one batch.
+    {
+        IouService service(1, 1 << 16, 200.0);
+        std::vector<std::future<IouResult> > futures;
+        for (int r = 0; r < 8; ++r) {
+            std::vector<Vertexes> D1s(C1s.begin() + r, C1s.begin() + r + 4);
+            futures.push_back(service.submit(D1s, C2s));
+        }
+        int nMaxBatch = 0;
+        for (int r = 0; r < 8; ++r) {
+            const IouResult result = futures[r].get();
+            std::vector<Vertexes> D1s(C1s.begin() + r, C1s.begin() + r + 4);
+            nFailed += !isResultOf(result, D1s, C2s);
+            nMaxBatch = std::max(nMaxBatch, result.batchRequests);
+        }
+        nFailed += nMaxBatch < 2;
+        nChecked += 9;
+    }
+
+    // A lone request waits for the delay, a full batch does not.
+    {
+        IouService service(1, (int)(C1s.size() * C2s.size()), 50.0);
+        std::vector<Vertexes> D1s(C1s.begin(), C1s.begin() + 1);
+        const IouResult late = service.submit(D1s, C2s).get();
+        nFailed += !(isResultOf(late, D1s, C2s) && late.batchRequests == 1 && late.queueMs >= 40.0);
+        ++nChecked;
+    }
+    {
+        IouService service(1, (int)(C1s.size() * C2s.size()), 10000.0);
+        const IouResult full = service.submit(C1s, C2s).get();
+        nFailed += !(isResultOf(full, C1s, C2s) && full.queueMs < 5000.0);
+        ++nChecked;
+    }
+
+    // Requests still queued at shutdown are answered, and callbacks that
+    // throw do not stop the workers.
+    {
+        std::vector<std::future<IouResult> > futures;
+        std::atomic<int> nCalled(0);
+        std::atomic<int> nGood(0);
+        {
+            IouService service(2, 1 << 16, 10000.0);
+            for (int r = 0; r < 6; ++r) {
+                futures.push_back(service.submit(C1s, C2s));
+                service.submit(C1s, C2s, [&](IouResult &result) {
+                    nGood += isResultOf(result, C1s, C2s);
+                    if (++nCalled % 2)
+                        throw 1;
+                });
+            }
+        }
+        for (int r = 0; r < (int)futures.size(); ++r) {
+            const bool bReady = futures[r].wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+            nFailed += !(bReady && isResultOf(futures[r].get(), C1s, C2s));
+        }
+        nFailed += nCalled != 6 || nGood != 6;
+        nChecked += futures.size() + 1;
+    }
+
+    return checkReport("service", nFailed, nChecked);
+}
@@ -0,0 +1,131 @@
+/***********************************
+ * check_simd.cpp
+ *
+ * Checks of iou_simd.h, for every instruction set this CPU runs.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "check.h"
+#include "../src/iou_clip.h"
+#include "../src/iou_simd.h"
+
+#include <algorithm>
+
+// Quad of kind k: rotated rectangles, random convex quads, quads with
+// a repeated or collinear vertex, then non-convex and flat ones.
+static void randomQuad(const int kind, const Point &c, Vertexes &C)
+{
+    switch (kind) {
+    case 0:
+        checkRectangle(c, checkRand(0.5, 4), checkRand(0.5, 4), checkRand(-M_PI, M_PI), C);
+        break;
+    case 1:
+        do {
+            checkConvex(c, checkRand(0.5, 3), checkRand(0.5, 3), 4, C);
+        } while (areaEx(C) < 0.1);
+        break;
+    case 2: {
+        checkConvex(c, checkRand(0.5, 3), checkRand(0.5, 3), 3, C);
+        const int k = checkRandInt(3);
+        const Point p = C[k];
+        C.insert(C.begin() + k + 1, p);
+        break;
+    }
+    case 3:
+        checkConvex(c, checkRand(0.5, 3), checkRand(0.5, 3), 3, C);
+        C.insert(C.begin() + 1, (C[0] + C[1]) * 0.5);
+        break;
+    case 4:
+        checkRectangle(c, 2.0, 1.0, checkRand(-M_PI, M_PI), C);
+        std::swap(C[0], C[1]);
+        break;
+    default:
+        C.clear();
+        for (int k = 0; k < 4; ++k)
+            C.push_back(c + Point(1.0, 0.5) * k);
+        break;
+    }
+    if (checkRandInt(2))
+        std::reverse(C.begin(), C.end());
+}
+// As the batch sees it, in anticlockwise. Return the area.
+static double prepare(Vertexes &C)
+{
+    double s2 = 0.0;
+    for (int k = 0; k < (int)C.size(); ++k) {
+        C[k] = Point((float)C[k].x, (float)C[k].y);
+        s2 += C[k] ^ C[(k + 1) % C.size()];
+    }
+    if (s2 < 0.0)
+        std::reverse(C.begin(), C.end());
+    return abs(s2) * 0.5;
+}
+
+bool checkSimd()
+{
+    int nFailed = 0;
+    int nChecked = 0;
+
+    // Sizes around every lane width, so each tail length is met.
+    std::vector<int> sizes;
+    for (int n = 1; n <= 40; ++n)
+        sizes.push_back(n);
+    sizes.push_back(1013);
+
+    const SimdIsa isa0 = simdIsa();
+    for (int n = 0; n < (int)sizes.size(); ++n) {
+        const int N = sizes[n];
+        QuadBatch Q1s, Q2s;
+        std::vector<Vertexes> C1s(N), C2s(N);
+        std::vector<double> area1(N), area2(N);
+        std::vector<int> kind(N);
+        for (int i = 0; i < N; ++i) {
+            const int kind1 = i % 5 == 0 ? checkRandInt(6) : checkRandInt(2);
+            int kind2 = i % 7 == 0 ? checkRandInt(6) : checkRandInt(2);
+            const Point c(checkRand(10, 14), checkRand(5, 9));
+            randomQuad(kind1, c, C1s[i]);
+            if (i % 11 == 0) {
+                C2s[i] = C1s[i];
+                kind2 = kind1;
+            }
+            else {
+                randomQuad(kind2, c + Point(checkRand(-2, 2), checkRand(-2, 2)), C2s[i]);
+            }
+            kind[i] = std::max(kind1, kind2);
+            Q1s.push_back(C1s[i]);
+            Q2s.push_back(C2s[i]);
+            area1[i] = prepare(C1s[i]);
+            area2[i] = prepare(C2s[i]);
+        }
+        for (int isa = IsaScalar; isa <= bestSimdIsa(); ++isa) {
+            setSimdIsa((SimdIsa)isa);
+            std::vector<float> areas, ious;
+            areaIntersectionBatch(Q1s, Q2s, areas);
+            iouBatch(Q1s, Q2s, ious);
+            int nBad = 0;
+            for (int i = 0; i < N; ++i) {
+                if (kind[i] == 5) {
+                    nBad += !(areas[i] == -1.0f || abs(areas[i]) < 1e-4f);
+                    continue;
+                }
+                if (kind[i] == 4) {
+                    nBad += areas[i] != -1.0f || ious[i] != -1.0f;
+                    continue;
+                }
+                Vertexes buf0, buf1;
+                const double ref = clipAreaConvex(C1s[i], C2s[i], buf0, buf1);
+                const double scale = std::max(area1[i], area2[i]);
+                nBad += !(abs(areas[i] - ref) <= 1e-4 * scale);
+                nBad += !(abs(ious[i] - ref / (area1[i] + area2[i] - ref)) <= 1e-3);
+            }
+            nFailed += nBad > 0;
+            ++nChecked;
+        }
+    }
+    setSimdIsa(isa0);
+
+    return checkReport("simd", nFailed, nChecked);
+}
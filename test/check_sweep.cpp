@@ -0,0 +1,88 @@
+/***********************************
+ * check_sweep.cpp
+ *
+ * Checks of iou_sweep.h, and of the clipper it uses.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "check.h"
+#include "../src/iou_clip.h"
+#include "../src/iou_sweep.h"
+
+#include <algorithm>
+#include <map>
+
+static double sampledIou(const Vertexes &C1, const Vertexes &C2)
+{
+    double x0 = C1[0].x, x1 = C1[0].x, y0 = C1[0].y, y1 = C1[0].y;
+    for (int s = 0; s < 2; ++s) {
+        const Vertexes &C = s == 0 ? C1 : C2;
+        for (int k = 0; k < (int)C.size(); ++k) {
+            x0 = std::min(x0, C[k].x);
+            x1 = std::max(x1, C[k].x);
+            y0 = std::min(y0, C[k].y);
+            y1 = std::max(y1, C[k].y);
+        }
+    }
+    const double inter = checkSampledArea([&](const Point &p) {
+        return checkInside(C1, p) && checkInside(C2, p); }, x0, y0, x1, y1, 400);
+    return inter / (areaEx(C1) + areaEx(C2) - inter);
+}
+
+bool checkSweep()
+{
+    int nFailed = 0;
+    int nChecked = 0;
+
+    // The clipper against sampling, in both wises.
+    for (int k = 0; k < 200; ++k) {
+        Vertexes C1, C2;
+        checkConvex(Point(checkRand(0, 3), checkRand(0, 3)), checkRand(1, 3), checkRand(1, 3),
+                    3 + checkRandInt(6), C1);
+        checkConvex(Point(checkRand(0, 3), checkRand(0, 3)), checkRand(1, 3), checkRand(1, 3),
+                    3 + checkRandInt(6), C2);
+        if (k % 2)
+            std::reverse(C2.begin(), C2.end());
+        nFailed += !(abs(iouClip(C1, C2) - sampledIou(C1, C2)) < 0.01);
+        ++nChecked;
+    }
+
+    // Dense rotated rectangles in both wises, a few non-convex polygons.
+    std::vector<Vertexes> Cs(3000);
+    for (int i = 0; i < (int)Cs.size(); ++i) {
+        checkRectangle(Point(checkRand(0, 100), checkRand(0, 100)),
+                       checkRand(1, 6), checkRand(1, 4), checkRand(-M_PI, M_PI), Cs[i]);
+        if (i % 2)
+            std::reverse(Cs[i].begin(), Cs[i].end());
+        if (i % 97 == 0)
+            std::swap(Cs[i][0], Cs[i][1]);
+    }
+    for (int t = 0; t < 2; ++t) {
+        const double thresh = t == 0 ? 0.0 : 0.3;
+        std::map<std::pair<int, int>, double> found;
+        forEachOverlappingPairEx(Cs, thresh, [&](const IouPair &pair) {
+            nFailed += !(pair.i < pair.j && found.count(std::make_pair(pair.i, pair.j)) == 0);
+            found[std::make_pair(pair.i, pair.j)] = pair.iou;
+        });
+        int nBrute = 0;
+        int nMissed = 0;
+        for (int i = 0; i < (int)Cs.size(); ++i) {
+            for (int j = i + 1; j < (int)Cs.size(); ++j) {
+                const double v = iouClip(Cs[i], Cs[j]);
+                if (!(v > thresh))
+                    continue;
+                ++nBrute;
+                std::map<std::pair<int, int>, double>::const_iterator it =
+                        found.find(std::make_pair(i, j));
+                nMissed += it == found.end() || abs(it->second - v) > 1e-9;
+            }
+        }
+        nFailed += nMissed != 0 || nBrute != (int)found.size() || nBrute == 0;
+        ++nChecked;
+    }
+
+    return checkReport("sweep", nFailed, nChecked);
+}
@@ -0,0 +1,110 @@
+/***********************************
+ * check_tile.cpp
+ *
+ * Checks of iou_tile.h.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "check.h"
+#include "../src/iou_tile.h"
+
+#include <algorithm>
+
+bool checkTile()
+{
+    int nFailed = 0;
+    int nChecked = 0;
+
+    // Objects on a jittered grid, none overlapping another, each small
+    // enough to lie whole in at least one tile.
+    const double tileW = 40.0;
+    const double overlap = 8.0;
+    const double step = tileW - overlap;
+    const int nTilesX = 6;
+    const int nTilesY = 5;
+    struct Object {
+        Point c;
+        double l, w, t;
+    };
+    std::vector<Object> objects;
+    for (double y = 4.0; y + 4.0 < nTilesY * step + overlap; y += 9.0) {
+        for (double x = 4.0; x + 4.0 < nTilesX * step + overlap; x += 9.0) {
+            Object o;
+            o.c = Point(x + checkRand(-1.0, 1.0), y + checkRand(-1.0, 1.0));
+            o.l = checkRand(2.0, 5.5);
+            o.w = checkRand(1.0, 5.5);
+            o.t = checkRand(-M_PI, M_PI);
+            objects.push_back(o);
+        }
+    }
+
+    // Each tile sees the objects lying whole in it, moved a little, with
+    // its own score. best[k] is the highest score given to object k.
+    std::vector<double> best(objects.size(), -1.0);
+    std::vector<std::vector<Vertexes> > tilePolys(nTilesX * nTilesY);
+    std::vector<std::vector<double> > tileScores(nTilesX * nTilesY);
+    std::vector<std::vector<int> > tileIds(nTilesX * nTilesY);
+    for (int ty = 0; ty < nTilesY; ++ty) {
+        for (int tx = 0; tx < nTilesX; ++tx) {
+            const int t = ty * nTilesX + tx;
+            for (int k = 0; k < (int)objects.size(); ++k) {
+                const Object &o = objects[k];
+                Vertexes C;
+                checkRectangle(o.c + Point(checkRand(-0.05, 0.05), checkRand(-0.05, 0.05)),
+                               o.l, o.w, o.t, C);
+                bool bWhole = true;
+                for (int v = 0; v < 4; ++v) {
+                    bWhole = bWhole && C[v].x >= tx * step && C[v].x <= tx * step + tileW &&
+                                       C[v].y >= ty * step && C[v].y <= ty * step + tileW;
+                }
+                if (!bWhole)
+                    continue;
+                if (checkRandInt(2))
+                    std::reverse(C.begin(), C.end());
+                const double score = checkRand(0.0, 1.0);
+                best[k] = std::max(best[k], score);
+                tilePolys[t].push_back(C);
+                tileScores[t].push_back(score);
+                tileIds[t].push_back(k);
+            }
+        }
+    }
+
+    std::vector<int> nEmitted(objects.size(), 0);
+    std::vector<double> emittedScore(objects.size(), -1.0);
+    int nTotal = 0;
+    int maxResidents = 0;
+    TileMerger merger(tileW, tileW, overlap, nTilesX, 0.5, [&](const Vertexes &C, double score) {
+        ++nTotal;
+        for (int k = 0; k < (int)objects.size(); ++k) {
+            if (checkInside(C, objects[k].c)) {
+                ++nEmitted[k];
+                emittedScore[k] = score;
+                break;
+            }
+        }
+    });
+    for (int t = 0; t < nTilesX * nTilesY; ++t) {
+        nFailed += !merger.addTile(t % nTilesX, t / nTilesX, tilePolys[t], tileScores[t]);
+        maxResidents = std::max(maxResidents, merger.residentCount());
+    }
+    nFailed += merger.addTile(0, 0, tilePolys[0], tileScores[0]);
+    merger.finish();
+    nChecked += nTilesX * nTilesY + 1;
+
+    // Every object seen once, with its best score, and only the border bands held.
+    int nSeen = 0;
+    for (int k = 0; k < (int)objects.size(); ++k) {
+        nSeen += best[k] >= 0.0;
+        nFailed += !(best[k] < 0.0 ? nEmitted[k] == 0 : nEmitted[k] == 1 && emittedScore[k] == best[k]);
+        ++nChecked;
+    }
+    nFailed += !(nTotal == nSeen && nSeen > 0 && merger.residentCount() == 0 &&
+                 maxResidents < (int)objects.size() / 2);
+    ++nChecked;
+
+    return checkReport("tile", nFailed, nChecked);
+}
@@ -0,0 +1,133 @@
+/***********************************
+ * check_union.cpp
+ *
+ * Checks of iou_union.h.
+ *
+ * Github: https://github.com/CheckBoxStudio/IoU
+ *
+ * 2026
+ ***********************************/
+
+#include "check.h"
+#include "../src/iou_clip.h"
+#include "../src/iou_union.h"
+
+#include <algorithm>
+
+static bool insideAny(const std::vector<Vertexes> &Cs, const Point &p)
+{
+    for (int i = 0; i < (int)Cs.size(); ++i) {
+        if (checkInside(Cs[i], p))
+            return true;
+    }
+    return false;
+}
+static void randomSet(const int n, const double range, std::vector<Vertexes> &Cs)
+{
+    Cs.resize(n);
+    for (int i = 0; i < n; ++i) {
+        checkConvex(Point(checkRand(0, range), checkRand(0, range)),
+                    checkRand(2, 8), checkRand(2, 8), 3 + checkRandInt(5), Cs[i]);
+        if (checkRandInt(2))
+            std::reverse(Cs[i].begin(), Cs[i].end());
+    }
+}
+
+bool checkUnion()
+{
+    int nFailed = 0;
+    int nChecked = 0;
+
+    // Two polygons, against the clipper.
+    for (int k = 0; k < 300; ++k) {
+        std::vector<Vertexes> Cs;
+        randomSet(2, 6.0, Cs);
+        const double inter = areaIntersectionClip(Cs[0], Cs[1]);
+        const double uni = areaEx(Cs[0]) + areaEx(Cs[1]) - inter;
+        nFailed += !(abs(areaUnionEx(Cs) - uni) < 1e-9 * uni);
+        nFailed += !(abs(areaIntersectionEx(std::vector<Vertexes>(1, Cs[0]),
+                                            std::vector<Vertexes>(1, Cs[1])) - inter) < 1e-9 * uni);
+        nChecked += 2;
+    }
+
+    // Repeated, nested, edge-sharing and non-convex polygons.
+    Vertexes sq1, sq2, sq3;
+    checkRectangle(Point(0.5, 0.5), 1.0, 1.0, 0.0, sq1);
+    checkRectangle(Point(1.5, 0.5), 1.0, 1.0, 0.0, sq2);
+    checkRectangle(Point(0.5, 0.5), 0.5, 0.5, 0.7, sq3);
+    std::vector<Vertexes> Cs;
+    Cs.push_back(sq1);
+    Cs.push_back(sq1);
+    Cs.push_back(sq3);
+    nFailed += !(abs(areaUnionEx(Cs) - 1.0) < 1e-12);
+    Cs.push_back(sq2);
+    nFailed += !(abs(areaUnionEx(Cs) - 2.0) < 1e-12);
+    nFailed += !(abs(iouEx(Cs, std::vector<Vertexes>(1, sq2)) - 0.5) < 1e-12);
+    std::swap(Cs[3][0], Cs[3][1]);
+    nFailed += !(areaUnionEx(Cs) == -1.0);
+    nFailed += !(areaUnionEx(std::vector<Vertexes>()) == 0.0);
+    nChecked += 5;
+
+    // A fan of triangles about one vertex, a grid of touching squares and
+    // a stack of long strips, against their areas.
+    std::vector<Vertexes> fan1, fan2, grid1, grid2, strips;
+    for (int k = 0; k < 12; ++k) {
+        Vertexes C;
+        C.push_back(Point(3, 3));
+        C.push_back(Point(3 + 2 * cos(k * M_PI / 6), 3 + 2 * sin(k * M_PI / 6)));
+        C.push_back(Point(3 + 2 * cos((k + 1) * M_PI / 6), 3 + 2 * sin((k + 1) * M_PI / 6)));
+        (k % 2 ? fan1 : fan2).push_back(C);
+    }
+    for (int i = 0; i < 6; ++i) {
+        for (int j = 0; j < 5; ++j) {
+            Vertexes C;
+            checkRectangle(Point(i + 0.5, j + 0.5), 1.0, 1.0, 0.0, C);
+            grid1.push_back(C);
+            if (i < 5) {
+                checkRectangle(Point(i + 1.0, j + 0.5), 1.0, 1.0, 0.0, C);
+                grid2.push_back(C);
+            }
+        }
+    }
+    for (int i = 0; i < 2000; ++i) {
+        Vertexes C;
+        checkRectangle(Point(500.0 + i * 1e-3, i + 0.25), 1000.0, 0.5, 0.0, C);
+        strips.push_back(C);
+    }
+    nFailed += !(abs(areaUnionEx(fan1) - 6.0) < 1e-12 && abs(areaUnionEx(fan1, fan2) - 12.0) < 1e-12 &&
+                 abs(areaIntersectionEx(fan1, fan2)) < 1e-12);
+    nFailed += !(abs(areaIntersectionEx(grid1, grid2) - 25.0) < 1e-12 && abs(areaUnionEx(grid1, grid2) - 30.0) < 1e-12);
+    nFailed += !(abs(areaUnionEx(strips) - 1e6) < 1e-6);
+    nChecked += 3;
+
+    // Many crossing polygons, against sampling.
+    for (int k = 0; k < 4; ++k) {
+        std::vector<Vertexes> Cs1, Cs2;
+        randomSet(40, 30.0, Cs1);
+        randomSet(40, 30.0, Cs2);
+        const int G = 800;
+        const double cell = 50.0 / G;
+        int n1 = 0, n2 = 0, n12 = 0, nUnion = 0;
+        for (int i = 0; i < G; ++i) {
+            for (int j = 0; j < G; ++j) {
+                const Point p(-10.0 + (i + 0.5) * cell, -10.0 + (j + 0.5) * cell);
+                const bool b1 = insideAny(Cs1, p);
+                const bool b2 = insideAny(Cs2, p);
+                n1 += b1;
+                n2 += b2;
+                n12 += b1 && b2;
+                nUnion += b1 || b2;
+            }
+        }
+        const double s = cell * cell;
+        const double tol = 0.002 * nUnion * s;
+        nFailed += !(abs(areaUnionEx(Cs1) - n1 * s) < tol);
+        nFailed += !(abs(areaUnionEx(Cs2) - n2 * s) < tol);
+        nFailed += !(abs(areaIntersectionEx(Cs1, Cs2) - n12 * s) < tol);
+        nFailed += !(abs(areaUnionEx(Cs1, Cs2) - nUnion * s) < tol);
+        nFailed += !(abs(iouEx(Cs1, Cs2) - (double)n12 / nUnion) < 0.005);
+        nChecked += 5;
+    }
+
+    return checkReport("union", nFailed, nChecked);
+}
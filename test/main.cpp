@@ -1,5 +1,6 @@
 #include <iostream>
 #include "test.h"
+#include "check.h"
 
 using namespace std;
 
@@ -13,10 +14,29 @@ int main()
 
     testConvexQuad(50,400,400);
 
+    testConvexQuadRle(50,400,400);
+
+    testUnionOfQuads(20,8,400,400);
+
+    bool bChecked = true;
+    bChecked = checkBox3d() && bChecked;
+    bChecked = checkSweep() && bChecked;
+    bChecked = checkTile() && bChecked;
+    bChecked = checkUnion() && bChecked;
+    bChecked = checkLocate() && bChecked;
+    bChecked = checkGjk() && bChecked;
+    bChecked = checkSimd() && bChecked;
+    bChecked = checkEngine() && bChecked;
+    bChecked = checkService() && bChecked;
+    bChecked = checkDecompose() && bChecked;
+    bChecked = checkCompact() && bChecked;
+    bChecked = checkIngest() && bChecked;
+    bChecked = checkRle() && bChecked;
+
     cout << "---------------------\n"
          << "I'm Done! Thank You\n"
          << endl;
 
-    return 0;
+    return bChecked ? 0 : 1;
 }
 
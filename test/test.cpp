@@ -168,6 +168,31 @@ double countPixel(
 
     return (i12*1.0)/(u12*1.0);
 }
+void encodeRle(const IplImage *pImg, const Channel channel, RLE &R)
+{
+    int k = channel;
+    int w = pImg->width;
+    int h = pImg->height;
+    int s = pImg->widthStep;
+    std::vector<unsigned int> counts;
+    bool bOne = false;
+    unsigned int run = 0;
+    uchar *pData = (uchar *)pImg->imageData;
+    for (int i=0; i<h; ++i) {
+        for (int j=0; j<w; ++j) {
+            bool b = pData[3*j+k] > 128;
+            if (b != bOne) {
+                counts.push_back(run);
+                run = 0;
+                bOne = b;
+            }
+            run++;
+        }
+        pData += s;
+    }
+    counts.push_back(run);
+    R = RLE(h, w, counts, RowMajor);
+}
 
 void testSquare(
         const int N,
@@ -272,3 +297,112 @@ void testConvexQuad(
     cvDestroyAllWindows();
 }
 
+
+void testConvexQuadRle(
+        const int N,
+        const int width, const int height,
+        const bool showup,
+        const int delay)
+{
+    printf("Test Convex Quad. vs. RLE [%d] Times with Image Size [%dx%d]\n",
+           N, width, height);
+    printf("No.    Method   Area_1   Area_2   Area_1x2  Area_1+2   IOU\n");
+    printf("^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^\n");
+    int C_n1, C_n2, C_i12, C_u12;
+    int E_n1, E_n2, E_i12, E_u12;
+    double C_iou, E_iou;
+    for (int k=0; k<N; ++k) {
+        Vertexes vert1, vert2;
+        conQuadVertex(width,height,vert1);
+        conQuadVertex(width,height,vert2);
+        IplImage *pImg1 = newEmptyImage(width, height);
+        IplImage *pImg2 = newEmptyImage(width, height);
+        IplImage *pImg3 = newEmptyImage(width, height);
+        drawConvexQuad(pImg1, vert1, C_R);
+        drawConvexQuad(pImg2, vert2, C_B);
+        cvAdd(pImg1,pImg2,pImg3);
+        if (showup) {
+            cvShowImage("Test_ConQuadRle", pImg3);
+            cvWaitKey(delay);
+        }
+        C_iou = countPixel(pImg3, C_R, C_B, C_n1, C_n2, C_i12, C_u12);
+        RLE rle2;
+        encodeRle(pImg3, C_B, rle2);
+        RLE rle1;
+        rleFromPolygon(vert1, height, width, rle1);
+        E_n1 = areaRle(rle1);
+        E_n2 = areaRle(rle2);
+        E_i12 = areaIntersectionRle(vert1,rle2);
+        E_u12 = areaUnionRle(vert1,rle2);
+        E_iou = iouRle(vert1,rle2);
+        printf("%05d  Count   %6d    %6d     %6d    %6d   %.3f\n",
+               k+1, C_n1, C_n2, C_i12, C_u12, C_iou);
+        printf("       RLE     %6d    %6d     %6d    %6d   %.3f\n",
+               E_n1, E_n2, E_i12, E_u12, E_iou);
+        if (abs(E_iou - C_iou) > 0.05 ||
+            abs(iouRle(rle1,rle2) - E_iou) > 1e-9) {
+            printf("--  Error in IOU, Please Check Me. --\n");
+        }
+        printf("----\n");
+
+        cvReleaseImage(&pImg1);
+        cvReleaseImage(&pImg2);
+        cvReleaseImage(&pImg3);
+    }
+
+    printf("\n");
+    cvDestroyAllWindows();
+}
+
+void testUnionOfQuads(
+        const int N, const int M,
+        const int width, const int height,
+        const bool showup,
+        const int delay)
+{
+    printf("Test Union of [%d] Convex Quad. [%d] Times with Image Size [%dx%d]\n",
+           M, N, width, height);
+    printf("No.    Method   Area_1   Area_2   Area_1x2  Area_1+2   IOU\n");
+    printf("^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^\n");
+    int C_n1, C_n2, C_i12, C_u12;
+    int E_n1, E_n2, E_i12, E_u12;
+    double C_iou, E_iou;
+    for (int k=0; k<N; ++k) {
+        std::vector<Vertexes> set1(M), set2(M);
+        IplImage *pImg1 = newEmptyImage(width, height);
+        IplImage *pImg2 = newEmptyImage(width, height);
+        IplImage *pImg3 = newEmptyImage(width, height);
+        for (int m=0; m<M; ++m) {
+            conQuadVertex(width,height,set1[m]);
+            conQuadVertex(width,height,set2[m]);
+            drawConvexQuad(pImg1, set1[m], C_R);
+            drawConvexQuad(pImg2, set2[m], C_B);
+        }
+        cvAdd(pImg1,pImg2,pImg3);
+        if (showup) {
+            cvShowImage("Test_UnionOfQuads", pImg3);
+            cvWaitKey(delay);
+        }
+        C_iou = countPixel(pImg3, C_R, C_B, C_n1, C_n2, C_i12, C_u12);
+        E_n1 = areaUnionEx(set1);
+        E_n2 = areaUnionEx(set2);
+        E_i12 = areaIntersectionEx(set1,set2);
+        E_u12 = areaUnionEx(set1,set2);
+        E_iou = iouEx(set1,set2);
+        printf("%05d  Count   %6d    %6d     %6d    %6d   %.3f\n",
+               k+1, C_n1, C_n2, C_i12, C_u12, C_iou);
+        printf("       Calcu   %6d    %6d     %6d    %6d   %.3f\n",
+               E_n1, E_n2, E_i12, E_u12, E_iou);
+        if (abs(E_iou - C_iou) > 0.05  ) {
+            printf("--  Error in IOU, Please Check Me. --\n");
+        }
+        printf("----\n");
+
+        cvReleaseImage(&pImg1);
+        cvReleaseImage(&pImg2);
+        cvReleaseImage(&pImg3);
+    }
+
+    printf("\n");
+    cvDestroyAllWindows();
+}
@@ -14,6 +14,8 @@
 #include <cv.h>
 #include <highgui.h>
 #include "../src/iou.h"
+#include "../src/iou_rle.h"
+#include "../src/iou_union.h"
 
 using namespace cv;
 using namespace IOU;
@@ -31,6 +33,7 @@ double countPixel(
         const IplImage *pImg,
         const Channel channel1, const Channel channel2,
         int &n1, int &n2, int &i12, int &u12);
+void encodeRle(const IplImage *pImg, const Channel channel, RLE &R);
 
 void testSquare(
         const int N,
@@ -42,5 +45,15 @@ void testConvexQuad(
         const int width, const int height,
         const bool showup = true,
         const int delay = 500);
+void testConvexQuadRle(
+        const int N,
+        const int width, const int height,
+        const bool showup = true,
+        const int delay = 500);
+void testUnionOfQuads(
+        const int N, const int M,
+        const int width, const int height,
+        const bool showup = true,
+        const int delay = 500);
 
 #endif // !_IOU_TEST_H_FILE_